@@ -46,6 +46,65 @@ enum OpenEEPROM_SpiMode {
     OPEN_EEPROM_SPI_MODE_3 = 8,
 };
 
+/**
+ * @enum OpenEEPROM_PageWriteFlag
+ *
+ * Options for a parallel page write.
+ */
+enum OpenEEPROM_PageWriteFlag {
+    OPEN_EEPROM_PAGE_WRITE_SDP_LOCK = 1,
+    OPEN_EEPROM_PAGE_WRITE_SDP_UNLOCK = 2,
+    OPEN_EEPROM_PAGE_WRITE_TOGGLE_BIT = 4,
+};
+
+/**
+ * @enum OpenEEPROM_WriteFlag
+ *
+ * Options that apply to every parallel write.
+ */
+enum OpenEEPROM_WriteFlag {
+    OPEN_EEPROM_WRITE_SKIP_EQUAL = 1,
+    OPEN_EEPROM_WRITE_SKIP_ERASED = 2,
+    OPEN_EEPROM_WRITE_WE_STROBE = 4,
+};
+
+/**
+ * @enum OpenEEPROM_ParallelProfile
+ *
+ * Chip families with built-in parallel bus timing.
+ */
+enum OpenEEPROM_ParallelProfile {
+    OPEN_EEPROM_PROFILE_28C64,
+    OPEN_EEPROM_PROFILE_28C256,
+    OPEN_EEPROM_PROFILE_27C256,
+    OPEN_EEPROM_PROFILE_29F010,
+    OPEN_EEPROM_PROFILE_39SF010,
+    OPEN_EEPROM_PROFILE_62256,
+    OPEN_EEPROM_PROFILE_DS1230,
+};
+
+/**
+ * @enum OpenEEPROM_MemoryTest
+ *
+ * Tests run by @ref OpenEEPROM_sramTest.
+ */
+enum OpenEEPROM_MemoryTest {
+    OPEN_EEPROM_MEMORY_TEST_MARCH_C_MINUS = 1,
+    OPEN_EEPROM_MEMORY_TEST_CHECKERBOARD = 2,
+    OPEN_EEPROM_MEMORY_TEST_ADDRESS = 4,
+};
+
+/**
+ * @enum OpenEEPROM_ProgramAlgorithm
+ *
+ * How a chip found by @ref OpenEEPROM_parallelIdentify is written.
+ */
+enum OpenEEPROM_ProgramAlgorithm {
+    OPEN_EEPROM_ALGORITHM_PAGE_WRITE,
+    OPEN_EEPROM_ALGORITHM_NOR_PROGRAM,
+    OPEN_EEPROM_ALGORITHM_NOR_BUFFER_PROGRAM,
+};
+
 /**
  * @enum OpenEEPROM_Command
  *
@@ -68,6 +127,25 @@ enum OpenEEPROM_Command {
     OPEN_EEPROM_CMD_SET_SPI_MODE,
     OPEN_EEPROM_CMD_GET_SUPPORTED_SPI_MODES,
     OPEN_EEPROM_CMD_SPI_TRANSMIT,
+    OPEN_EEPROM_CMD_MEASURE_DELAY,
+    OPEN_EEPROM_CMD_PARALLEL_PAGE_WRITE,
+    OPEN_EEPROM_CMD_NOR_PROGRAM,
+    OPEN_EEPROM_CMD_NOR_SECTOR_ERASE,
+    OPEN_EEPROM_CMD_NOR_CHIP_ERASE,
+    OPEN_EEPROM_CMD_NOR_BYPASS_PROGRAM,
+    OPEN_EEPROM_CMD_NOR_BUFFER_PROGRAM,
+    OPEN_EEPROM_CMD_EPROM_PROGRAM,
+    OPEN_EEPROM_CMD_PARALLEL_READ_WORDS,
+    OPEN_EEPROM_CMD_PARALLEL_WRITE_WORDS,
+    OPEN_EEPROM_CMD_SET_PARALLEL_WRITE_FLAGS,
+    OPEN_EEPROM_CMD_PARALLEL_FILL,
+    OPEN_EEPROM_CMD_SPI_FILL,
+    OPEN_EEPROM_CMD_SET_PARALLEL_TIMING,
+    OPEN_EEPROM_CMD_SET_PARALLEL_PROFILE,
+    OPEN_EEPROM_CMD_PARALLEL_IDENTIFY,
+    OPEN_EEPROM_CMD_TUNE_READ_TIMING,
+    OPEN_EEPROM_CMD_SRAM_TEST,
+    OPEN_EEPROM_CMD_SET_PAGE_READ,
 };
 
 extern const uint8_t OpenEEPROM_ACK;
@@ -82,19 +160,38 @@ int OpenEEPROM_getSupportedBusTypes(const char *in, char *out);
 int OpenEEPROM_getMaxRxSize(const char *in, char *out);
 int OpenEEPROM_getMaxTxSize(const char *in, char *out);
 int OpenEEPROM_toggleIO(const char *in, char *out);
+int OpenEEPROM_measureDelay(const char *in, char *out);
 
 /* Parallel Commands */
 int OpenEEPROM_setAddressBusWidth(const char *in, char *out);
 int OpenEEPROM_setAddressHoldTime(const char *in, char *out);
 int OpenEEPROM_setAddressPulseWidthTime(const char *in, char *out);
+int OpenEEPROM_setParallelWriteFlags(const char *in, char *out);
+int OpenEEPROM_setParallelTiming(const char *in, char *out);
+int OpenEEPROM_setParallelProfile(const char *in, char *out);
+int OpenEEPROM_setPageRead(const char *in, char *out);
+int OpenEEPROM_parallelIdentify(const char *in, char *out);
+int OpenEEPROM_tuneReadTiming(const char *in, char *out);
 int OpenEEPROM_parallelRead(const char *in, char *out);
 int OpenEEPROM_parallelWrite(const char *in, char *out);
+int OpenEEPROM_parallelPageWrite(const char *in, char *out);
+int OpenEEPROM_norProgram(const char *in, char *out);
+int OpenEEPROM_norSectorErase(const char *in, char *out);
+int OpenEEPROM_norChipErase(const char *in, char *out);
+int OpenEEPROM_norBypassProgram(const char *in, char *out);
+int OpenEEPROM_norBufferProgram(const char *in, char *out);
+int OpenEEPROM_epromProgram(const char *in, char *out);
+int OpenEEPROM_parallelReadWords(const char *in, char *out);
+int OpenEEPROM_parallelWriteWords(const char *in, char *out);
+int OpenEEPROM_parallelFill(const char *in, char *out);
+int OpenEEPROM_sramTest(const char *in, char *out);
 
 /* SPI Commands */
 int OpenEEPROM_setSpiFrequency(const char *in, char *out);
 int OpenEEPROM_setSpiMode(const char *in, char *out);
 int OpenEEPROM_getSupportedSpiModes(const char *in, char *out);
 int OpenEEPROM_spiTransmit(const char *in, char *out);
+int OpenEEPROM_spiFill(const char *in, char *out);
 
 #endif /* __OPEN_EEPROM_H__ */
 
@@ -6,6 +6,42 @@
 #define OPEN_EEPROM_VERSION_NUMBER        0x01
 #define OPEN_EEPROM_SUPPORTED_BUS_TYPES   OPEN_EEPROM_BUS_MODE_PARALLEL | OPEN_EEPROM_BUS_MODE_SPI;  
 
+/* 
+ * Longest time, in microseconds, to wait for a parallel chip's 
+ * internal write cycle (EEPROM tWC, NOR program and erase times).
+ */
+#define OPEN_EEPROM_WRITE_CYCLE_TIMEOUT       10000
+#define OPEN_EEPROM_NOR_PROGRAM_TIMEOUT       1000
+#define OPEN_EEPROM_NOR_SECTOR_ERASE_TIMEOUT  10000000
+#define OPEN_EEPROM_NOR_CHIP_ERASE_TIMEOUT    256000000
+
+/* 
+ * EPROM programming: Vpp setup time before the first pulse in 
+ * nanoseconds, and the most failing addresses reported per command.
+ */
+#define OPEN_EEPROM_VPP_SETUP_TIME            2000
+#define OPEN_EEPROM_EPROM_MAX_FAILURES        32
+
+/* Most failing addresses reported by the SRAM test. */
+#define OPEN_EEPROM_MEMORY_TEST_MAX_FAILURES  32
+
+/* Longest repeating pattern accepted by the fill commands. */
+#define OPEN_EEPROM_FILL_PATTERN_MAX          16
+
+/* Read access time, in nanoseconds, timing auto-tune starts from. */
+#define OPEN_EEPROM_TUNE_SLOW_ACCESS_TIME     1000
+
+/* 
+ * Use the programmer's width-specialized parallel read/write 
+ * kernels instead of the generic per-byte programmer calls.
+ */
+//#define OPEN_EEPROM_PARALLEL_KERNELS
+
+/*
+ * Let the programmer capture parallel reads in hardware 
+ * (e.g. timer-paced DMA) instead of reading each byte in a loop.
+ */
+//#define OPEN_EEPROM_PARALLEL_CAPTURE
 
 #endif /* __OPEN_EEPROM_CONF_H__ */
 
@@ -11,6 +11,7 @@
 
 #include <stdint.h>
 #include <stddef.h>
+#include "open-eeprom_conf.h"
 
 /**
  * @brief Minimum delay, in nanoseconds, supported by the programmer.
@@ -93,15 +94,49 @@ int Programmer_getAddressPinCount(void);
  */
 int Programmer_setAddress(uint8_t busWidth, uint32_t address);
 
+/**
+ * @brief Move the address bus to a new value during sequential access.
+ *
+ * Behaves like @ref Programmer_setAddress, but may assume the bus still 
+ * holds the address from the previous call to either function and only 
+ * drive the lines whose value changes. Sequential reads and writes use this
+ * so that stepping to the next address only touches a few low order lines.
+ *
+ * Programmers that cannot track the bus state may simply 
+ * call @ref Programmer_setAddress.
+ *
+ * @param busWidth max bits to use from `address`
+ *
+ * @param address value to output on the bus corresponding to [An:A0]
+ */
+int Programmer_advanceAddress(uint8_t busWidth, uint32_t address);
+
+/**
+ * @brief Get the number of data lines the programmer supports.
+ *
+ * @return 8, or 16 if the programmer has a word-wide data bus
+ */
+int Programmer_getDataPinCount(void);
+
 /**
  * @brief Set the value outputted on the data bus.
  *
- * Currently only a fixed 8-bit data bus is supported.
+ * Only drives [D7:D0]. Use @ref Programmer_setDataWord 
+ * for a 16-bit bus.
  *
  * @param data value to output on the bus
  */
 int Programmer_setData(uint8_t data);
 
+/**
+ * @brief Set the value outputted on a 16-bit data bus.
+ *
+ * Programmers with an 8-bit data bus only output the low byte.
+ *
+ * @param data value to output on the bus, [D15:D0]
+ */
+int Programmer_setDataWord(uint16_t data);
+
 /**
  * @brief Read the values on the data bus.
  * 
@@ -113,6 +148,94 @@ int Programmer_setData(uint8_t data);
  */
 uint8_t Programmer_getData(void);
 
+/**
+ * @brief Read the values on a 16-bit data bus.
+ *
+ * Same as @ref Programmer_getData, but for all 16 data lines.
+ * Programmers with an 8-bit data bus return 0 in the high byte.
+ *
+ * @return the value being inputted into the data lines, [D15:D0]
+ */
+uint16_t Programmer_getDataWord(void);
+
+#ifdef OPEN_EEPROM_PARALLEL_KERNELS
+/**
+ * @brief Read `count` consecutive bytes using a kernel specialized
+ *      for the address bus width.
+ *
+ * Only required when `OPEN_EEPROM_PARALLEL_KERNELS` is defined.
+ * The caller has already configured the data lines as inputs and 
+ * asserted CE and OE. The kernel must behave exactly like the generic 
+ * loop built from @ref Programmer_advanceAddress, @ref Programmer_delayTicks 
+ * and @ref Programmer_getData.
+ *
+ * @param busWidth width of the address bus
+ *
+ * @param address first address to read
+ *
+ * @param buf buffer of at least `count` bytes for the read data
+ *
+ * @param count number of bytes to read
+ *
+ * @param holdTime delay ticks to wait after setting each address
+ *
+ * @return 1 if a kernel exists for `busWidth`, else 0 and nothing is read
+ */
+int Programmer_parallelReadKernel(uint8_t busWidth, uint32_t address, 
+        char *buf, size_t count, uint32_t holdTime);
+
+/**
+ * @brief Write `count` consecutive bytes using a kernel specialized
+ *      for the address bus width.
+ *
+ * Only required when `OPEN_EEPROM_PARALLEL_KERNELS` is defined.
+ * The caller has already configured the data lines as outputs, 
+ * deasserted OE and asserted WE. Each byte is strobed with CE.
+ *
+ * @param busWidth width of the address bus
+ *
+ * @param address first address to write
+ *
+ * @param buf bytes to write
+ *
+ * @param count number of bytes to write
+ *
+ * @param holdTime delay ticks to wait after setting each address
+ *
+ * @param pulseTime delay ticks to hold CE low for each byte
+ *
+ * @return 1 if a kernel exists for `busWidth`, else 0 and nothing is written
+ */
+int Programmer_parallelWriteKernel(uint8_t busWidth, uint32_t address, 
+        const char *buf, size_t count, uint32_t holdTime, uint32_t pulseTime);
+#endif
+
+#ifdef OPEN_EEPROM_PARALLEL_CAPTURE
+/**
+ * @brief Read `count` consecutive bytes with hardware-paced capture.
+ *
+ * Only required when `OPEN_EEPROM_PARALLEL_CAPTURE` is defined.
+ * Preconditions and results are the same as for a parallel read 
+ * kernel, but every byte is sampled at a fixed rate by hardware
+ * rather than by the CPU. Each address is held for at least 
+ * `holdTime` before its byte is sampled.
+ *
+ * @param busWidth width of the address bus
+ *
+ * @param address first address to read
+ *
+ * @param buf buffer of at least `count` bytes for the read data
+ *
+ * @param count number of bytes to read
+ *
+ * @param holdTime delay ticks to wait after setting each address
+ *
+ * @return 1 if the bytes were captured, else 0 and nothing is read
+ */
+int Programmer_parallelReadCapture(uint8_t busWidth, uint32_t address, 
+        char *buf, size_t count, uint32_t holdTime);
+#endif
+
 /**
  * @brief Toggle the IO line that serves as the CE control line.
  *
@@ -120,6 +243,27 @@ uint8_t Programmer_getData(void);
  */
 int Programmer_toggleCE(uint8_t state);
 
+/**
+ * @brief Start a low pulse on the CE control line.
+ *
+ * CE is the write strobe, so the pulse must last at least `ticks`. 
+ * Programmers that time the strobe in hardware may return 
+ * while the pulse is still running. The caller must not change 
+ * the address or data lines until @ref Programmer_waitCEPulse returns, 
+ * since memories latch data on the rising edge of the strobe.
+ *
+ * @param ticks pulse width in delay ticks, see @ref Programmer_nsToDelayTicks
+ */
+int Programmer_startCEPulse(uint32_t ticks);
+
+/**
+ * @brief Wait for a pulse started by @ref Programmer_startCEPulse 
+ *      to finish.
+ *
+ * CE is high again when this function returns.
+ */
+int Programmer_waitCEPulse(void);
+
 /**
  * @brief Toggle the IO line that serves as the OE control line.
  *
@@ -134,6 +278,16 @@ int Programmer_toggleOE(uint8_t state);
  */
 int Programmer_toggleWE(uint8_t state);
 
+/**
+ * @brief Toggle the IO line that switches the programming voltage 
+ *      (Vpp/PGM) of an EPROM.
+ *
+ * The line is off whenever the parallel bus is set up or left.
+ *
+ * @param state 0 remove the programming voltage, else apply it
+ */
+int Programmer_toggleVpp(uint8_t state);
+
 /**
  * @brief Wait for `delay` nanoseconds.
  *
@@ -145,6 +299,41 @@ int Programmer_toggleWE(uint8_t state);
  */
 int Programmer_delay1ns(uint32_t delay);
 
+/**
+ * @brief Convert a delay in nanoseconds into programmer delay ticks.
+ *
+ * Ticks are whatever unit @ref Programmer_delayTicks counts in.
+ * The conversion is done once, when a timing parameter is set, so that
+ * per-byte bus loops do not pay for it. The result should already 
+ * account for the time spent on the bus access that ends the delay, 
+ * so that the whole bus phase lasts at least `delay` nanoseconds.
+ *
+ * @param delay number of nanoseconds
+ *
+ * @return equivalent number of delay ticks
+ */
+uint32_t Programmer_nsToDelayTicks(uint32_t delay);
+
+/**
+ * @brief Wait for a delay previously converted 
+ *      by @ref Programmer_nsToDelayTicks.
+ *
+ * @param ticks number of delay ticks to wait
+ */
+int Programmer_delayTicks(uint32_t ticks);
+
+/**
+ * @brief Measure how long a bus phase of `delay` nanoseconds 
+ *      actually lasts.
+ *
+ * Used to check the calibration of the delay functions.
+ *
+ * @param delay requested number of nanoseconds
+ *
+ * @return measured number of nanoseconds
+ */
+uint32_t Programmer_measureDelay(uint32_t delay);
+
 /**
  * @brief Set the clock frequency of the SPI peripheral. 
  *
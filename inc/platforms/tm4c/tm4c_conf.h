@@ -0,0 +1,58 @@
+/**
+ * @file
+ *
+ * Build options for the TM4C programmer.
+ */
+
+#ifndef __TM4C_CONF_H__
+#define __TM4C_CONF_H__
+
+/* 
+ * Access the GPIO ports through the AHB aperture instead of the 
+ * legacy APB aperture and drive the parallel bus and SPI CS pins 
+ * harder. AHB GPIO accesses complete in a single cycle.
+ */
+//#define TM4C_GPIO_AHB
+
+/*
+ * Generate the CE write strobe with wide timer 1A in PWM mode
+ * instead of a software delay, so its width does not depend on
+ * call overhead or interrupts. CE must be wired to PC6 (WT1CCP0)
+ * instead of PA2.
+ */
+//#define TM4C_TIMED_STROBE
+
+/*
+ * Drive the address bus from an external binary counter chain 
+ * (e.g. 74HC4040/4020) instead of the A0-A14 pins. The counter is 
+ * clocked from PB3 (counting on the falling edge) and reset from 
+ * PF3 (active high), so sequential accesses cost one clock pulse
+ * and the address space is only limited by the counter's width.
+ * Seeking backwards resets the counter and clocks up again.
+ * Cannot be combined with the parallel kernels or capture engine,
+ * which drive the address pins directly.
+ */
+//#define TM4C_ADDRESS_COUNTER
+#define TM4C_ADDRESS_COUNTER_WIDTH 24
+
+/*
+ * Drive the address bits above A12 from 74HC595-style shift registers
+ * loaded by SSI1 (SCK on PD0, SER on PD3) and latched from PD1, instead 
+ * of the A13/A14 pins. The registers are only reloaded when the upper
+ * address bits change. TM4C_ADDRESS_SHIFT_BITS is the length of the
+ * register chain, 4 to 16 bits. On the LaunchPad, R9/R10 must be 
+ * removed since they tie PD0/PD1 to PB6/PB7.
+ */
+//#define TM4C_ADDRESS_SHIFT
+#define TM4C_ADDRESS_SHIFT_BITS 8
+
+/*
+ * Add a second data pin group for D8-D15 so x16 parts (27C400, 
+ * 29F400 with BYTE# high) move a word per bus cycle. The group takes
+ * over the A8-A12 pins, so this needs TM4C_ADDRESS_SHIFT and only 
+ * A0-A7 stay direct; TM4C_ADDRESS_SHIFT_BITS should be 16. D8-D15 
+ * are on PA7, PF1, PE3, PE2, PE1, PD2, PB3 and PF4.
+ */
+//#define TM4C_DATA_WORD
+
+#endif /* __TM4C_CONF_H__ */
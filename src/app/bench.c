@@ -0,0 +1,137 @@
+#include <stdint.h>
+#include <stdbool.h>
+#include "string.h"
+#include "open-eeprom_conf.h"
+#include "open-eeprom.h"
+#include "open-eeprom_server.h"
+#include "programmer.h"
+#include "platforms/tm4c/driverlib/hw_memmap.h"
+#include "platforms/tm4c/driverlib/hw_types.h"
+#include "platforms/tm4c/driverlib/hw_nvic.h"
+#include "platforms/tm4c/driverlib/gpio.h"
+#include "platforms/tm4c/driverlib/sysctl.h"
+#include "platforms/tm4c/driverlib/systick.h"
+#include "platforms/tm4c/tm4c_conf.h"
+
+#define BENCH_BYTE_COUNT 1024
+
+/* A port of the address bus, through the aperture the platform uses. */
+#ifdef TM4C_GPIO_AHB
+#define BENCH_ADDRESS_PORT GPIO_PORTB_AHB_BASE
+#else
+#define BENCH_ADDRESS_PORT GPIO_PORTB_BASE
+#endif
+
+/*
+ * Results are left here to be inspected from the debugger.
+ * All values are in system clock cycles per byte.
+ */
+volatile uint32_t BenchPinWriteAddressCycles;
+volatile uint32_t BenchSetAddressCycles;
+volatile uint32_t BenchAdvanceAddressCycles;
+volatile uint32_t BenchSetDataCycles;
+volatile uint32_t BenchGetDataCycles;
+
+/* Read throughput in bytes/s of the generic loop and the width kernels. */
+volatile uint32_t BenchGenericReadRate;
+volatile uint32_t BenchKernelReadRate;
+volatile uint32_t BenchCaptureReadRate;
+
+static char BenchBuf[BENCH_BYTE_COUNT];
+
+/* SysTick is a 24-bit down counter clocked by the system clock. */
+static uint32_t benchStart(void) {
+    SysTickPeriodSet(NVIC_ST_RELOAD_M + 1);
+    SysTickEnable();
+    HWREG(NVIC_ST_CURRENT) = 0;
+    return SysTickValueGet();
+}
+
+static uint32_t benchElapsed(uint32_t start) {
+    return (start - SysTickValueGet()) & NVIC_ST_CURRENT_M;
+}
+
+/*
+ * The address update Programmer_setAddress replaced, one GPIOPinWrite 
+ * per address bit, as the baseline for BenchSetAddressCycles. The pin
+ * mask is empty, so each call makes the same store without moving a pin.
+ */
+static void benchPinWriteAddress(uint8_t busWidth, uint32_t address) {
+    for (int i = 0; i < busWidth; i++) {
+        GPIOPinWrite(BENCH_ADDRESS_PORT, 0, address & 1 ? 0xFF : 0);
+        address >>= 1;
+    }
+}
+
+/* Scaled down to stay in 32 bits; the target has no 64-bit divide. */
+static uint32_t benchRate(uint32_t cycles, uint32_t count) {
+    cycles = (cycles / 256) ? (cycles / 256) : 1;
+    return (SysCtlClockGet() / 256) * count / cycles;
+}
+
+int benchParallel(void) {
+    uint32_t start, holdTicks;
+
+    Programmer_init();
+    Programmer_initParallel();
+
+    start = benchStart();
+    for (uint32_t i = 0; i < BENCH_BYTE_COUNT; i++) {
+        benchPinWriteAddress(Programmer_getAddressPinCount(), i);
+    }
+    BenchPinWriteAddressCycles = benchElapsed(start) / BENCH_BYTE_COUNT;
+
+    start = benchStart();
+    for (uint32_t i = 0; i < BENCH_BYTE_COUNT; i++) {
+        Programmer_setAddress(Programmer_getAddressPinCount(), i);
+    }
+    BenchSetAddressCycles = benchElapsed(start) / BENCH_BYTE_COUNT;
+
+    Programmer_setAddress(Programmer_getAddressPinCount(), 0);
+    start = benchStart();
+    for (uint32_t i = 0; i < BENCH_BYTE_COUNT; i++) {
+        Programmer_advanceAddress(Programmer_getAddressPinCount(), i);
+    }
+    BenchAdvanceAddressCycles = benchElapsed(start) / BENCH_BYTE_COUNT;
+
+    Programmer_toggleDataIOMode(1);
+    start = benchStart();
+    for (uint32_t i = 0; i < BENCH_BYTE_COUNT; i++) {
+        Programmer_setData(i);
+    }
+    BenchSetDataCycles = benchElapsed(start) / BENCH_BYTE_COUNT;
+
+    Programmer_toggleDataIOMode(0);
+    start = benchStart();
+    for (uint32_t i = 0; i < BENCH_BYTE_COUNT; i++) {
+        Programmer_getData();
+    }
+    BenchGetDataCycles = benchElapsed(start) / BENCH_BYTE_COUNT;
+
+    /* The same loop OpenEEPROM_parallelRead runs without kernels. */
+    holdTicks = Programmer_nsToDelayTicks(Programmer_MinimumDelay);
+    start = benchStart();
+    Programmer_setAddress(Programmer_getAddressPinCount(), 0);
+    for (uint32_t i = 0; i < BENCH_BYTE_COUNT; i++) {
+        Programmer_advanceAddress(Programmer_getAddressPinCount(), i);
+        Programmer_delayTicks(holdTicks);
+        BenchBuf[i] = Programmer_getData();
+    }
+    BenchGenericReadRate = benchRate(benchElapsed(start), BENCH_BYTE_COUNT);
+
+#ifdef OPEN_EEPROM_PARALLEL_KERNELS
+    start = benchStart();
+    Programmer_parallelReadKernel(Programmer_getAddressPinCount(), 0, 
+            BenchBuf, BENCH_BYTE_COUNT, holdTicks);
+    BenchKernelReadRate = benchRate(benchElapsed(start), BENCH_BYTE_COUNT);
+#endif
+
+#ifdef OPEN_EEPROM_PARALLEL_CAPTURE
+    start = benchStart();
+    Programmer_parallelReadCapture(Programmer_getAddressPinCount(), 0, 
+            BenchBuf, BENCH_BYTE_COUNT, holdTicks);
+    BenchCaptureReadRate = benchRate(benchElapsed(start), BENCH_BYTE_COUNT);
+#endif
+
+    return 1;
+}
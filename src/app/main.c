@@ -11,6 +11,7 @@ static char TxBuf[1024];
 int testGeneralCommands(void);
 int testParallel(void);
 int testSpi(void);
+int benchParallel(void);
 
 int main(void){
 
@@ -26,6 +27,10 @@ int main(void){
     int result = testSpi();
 #endif
 
+#ifdef RUN_BENCHMARKS
+    int result = benchParallel();
+#endif
+
     OpenEEPROM_serverInit(RxBuf, sizeof(RxBuf), TxBuf, sizeof(TxBuf));
 
     while (1) {
@@ -48,6 +48,14 @@ int testGeneralCommands(void) {
     result &= response_len == 2;
     result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0}, response_len) == 0;
 
+    uint32_t measured;
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_MEASURE_DELAY, 0xe8, 0x03, 0, 0}, 5);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 9;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0xe8, 0x03, 0, 0}, 5) == 0;
+    memcpy(&measured, &TxBuf[5], sizeof(measured));
+    result &= measured >= 1000;
+
     return result;
 }
 
@@ -72,6 +80,19 @@ int testParallel(void) {
     result &= response_len == 5;
     result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 250, 0, 0, 0}, response_len) == 0;
 
+    // a profile sets all five times at once, here the SRAM's 70ns tWC
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_SET_PARALLEL_PROFILE, OPEN_EEPROM_PROFILE_62256}, 2);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 21;
+    result &= TxBuf[0] == OpenEEPROM_ACK && TxBuf[17] == 70;
+
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_SET_PARALLEL_TIMING, 250, 0, 0, 0, 250, 0, 0, 0,
+            0, 0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0}, 21);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 21;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 250, 0, 0, 0, 250, 0, 0, 0, 
+            0, 0, 0, 0, 250, 0, 0, 0, 0, 0, 0, 0}, response_len) == 0;
+
     memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_PARALLEL_WRITE, 0, 0, 0, 0, 0x04, 0, 0 ,0, 0xab, 0xcd, 0xef, 0x01}, 13);
     response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
     result &= response_len == 1;
@@ -85,6 +106,58 @@ int testParallel(void) {
     result &= response_len == 5;
     result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0xab, 0xcd, 0xef, 0x01}, response_len) == 0;
 
+    // a page write returns once DATA# polling sees the write complete
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_PARALLEL_PAGE_WRITE, 0x3e, 0, 0, 0, 0x04, 0, 0 ,0, 
+            64, 0, 0, 0x12, 0x34, 0x56, 0x78}, 16);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 9;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0x04, 0, 0, 0, 0, 0, 0, 0}, response_len) == 0;
+
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_PARALLEL_READ, 0x3e, 0, 0, 0, 0x4, 0, 0 ,0}, 9);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 5;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0x12, 0x34, 0x56, 0x78}, response_len) == 0;
+
+    // with skip-if-equal, rewriting the same data takes no write cycles
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_SET_PARALLEL_WRITE_FLAGS, OPEN_EEPROM_WRITE_SKIP_EQUAL}, 2);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 2;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, OPEN_EEPROM_WRITE_SKIP_EQUAL}, response_len) == 0;
+
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_PARALLEL_WRITE, 0, 0, 0, 0, 0x04, 0, 0 ,0, 0xab, 0xcd, 0xef, 0x01}, 13);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 5;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0x04, 0, 0, 0}, response_len) == 0;
+
+    // only the two changed bytes are written, and read back once their write is done
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_PARALLEL_WRITE, 0, 0, 0, 0, 0x04, 0, 0 ,0, 0xab, 0x11, 0xef, 0x22}, 13);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 5;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0x02, 0, 0, 0}, response_len) == 0;
+
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_PARALLEL_READ, 0, 0, 0, 0, 0x4, 0, 0 ,0}, 9);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 5;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0xab, 0x11, 0xef, 0x22}, response_len) == 0;
+
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_SET_PARALLEL_WRITE_FLAGS, 0}, 2);
+    OpenEEPROM_runCommand(RxBuf, TxBuf);
+
+    // fill 6 bytes with single write cycles from a repeating 2-byte pattern
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_PARALLEL_FILL, 0, 0, 0, 0, 0x06, 0, 0, 0, 0, 0, 0,
+            0x02, 0x5a, 0xa5}, 15);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 9;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0x06, 0, 0, 0, 0, 0, 0, 0}, response_len) == 0;
+
+    // delay some time for the write to complete
+    Programmer_delay1ns(10000000);
+
+    memcpy(RxBuf, (char[]) {OPEN_EEPROM_CMD_PARALLEL_READ, 0, 0, 0, 0, 0x06, 0, 0 ,0}, 9);
+    response_len = OpenEEPROM_runCommand(RxBuf, TxBuf);
+    result &= response_len == 7;
+    result &= memcmp(TxBuf, (char[]) {OpenEEPROM_ACK, 0x5a, 0xa5, 0x5a, 0xa5, 0x5a, 0xa5}, response_len) == 0;
+
     return result;
 }
 
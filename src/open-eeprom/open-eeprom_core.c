@@ -26,6 +26,11 @@
 #include "open-eeprom.h"
 #include "programmer.h"
 
+/* Largest page that can be compared before it is loaded. */
+#define COMPARE_PAGE_SIZE_MAX 256
+#define SPI_PAGE_SIZE_MAX 256
+#define SKIP_WRITE_FLAGS (OPEN_EEPROM_WRITE_SKIP_EQUAL | OPEN_EEPROM_WRITE_SKIP_ERASED)
+
 /**
  * @brief Command acknowledged, success.
  */
@@ -44,11 +49,153 @@ static uint8_t CurrentAddressBusWidth = 0;
 static uint32_t CurrentSpiFrequency = 0;
 static enum OpenEEPROM_SpiMode CurrentSpiMode = OPEN_EEPROM_SPI_MODE_0; 
 
-static uint32_t ParallelAddressHoldTime;
-static uint32_t ChipEnablePulseWidthTime;
+static uint8_t ParallelWriteFlags;
+/*
+ * Parallel bus timing in nanoseconds, in the order the 
+ * timing commands send it: tAS, tACC, tOE, tWP and tWC.
+ */
+struct ParallelTiming {
+    uint32_t addressSetup;
+    uint32_t readAccess;
+    uint32_t outputEnable;
+    uint32_t writePulse;
+    uint32_t writeCycle;
+};
+
+static struct ParallelTiming Timing;
+
+/* The timing parameters above, pre-converted into programmer delay ticks. */
+static uint32_t AddressSetupTicks;
+static uint32_t ReadAccessTicks;
+static uint32_t ReadCycleTicks;
+static uint32_t WritePulseTicks;
+static uint32_t WriteRecoveryTicks;
+
+/*
+ * Page-mode reads: addresses within an aligned page of 
+ * PageReadMask + 1 locations after the first come out after
+ * tPACC instead of tACC. A mask of 0 turns page mode off.
+ */
+static uint32_t PageReadMask;
+static uint32_t PageAccessTime;
+static uint32_t PageAccessTicks;
+
+/*
+ * Datasheet timing of the fastest common speed grade, indexed by 
+ * OpenEEPROM_ParallelProfile. A tWP of 0 marks parts that are not 
+ * written with bus write cycles, and a tWC of 0 parts with no 
+ * minimum bus write cycle.
+ */
+static const struct ParallelTiming Profiles[] = {
+    [OPEN_EEPROM_PROFILE_28C64]   = {0, 150, 70, 100, 0},
+    [OPEN_EEPROM_PROFILE_28C256]  = {0, 150, 70, 100, 0},
+    [OPEN_EEPROM_PROFILE_27C256]  = {2000, 150, 70, 0, 0},
+    [OPEN_EEPROM_PROFILE_29F010]  = {0, 90, 35, 45, 90},
+    [OPEN_EEPROM_PROFILE_39SF010] = {0, 70, 35, 40, 70},
+    [OPEN_EEPROM_PROFILE_62256]   = {0, 70, 35, 50, 70},
+    [OPEN_EEPROM_PROFILE_DS1230]  = {0, 70, 35, 55, 70},
+};
+
+/*
+ * Conservative timing used to read a chip's ID before 
+ * anything is known about it.
+ */
+static const struct ParallelTiming IdentifyTiming = {250, 250, 250, 250, 0};
+
+/* Parts OpenEEPROM_parallelIdentify recognizes by their JEDEC ID. */
+struct ChipId {
+    uint8_t manufacturer;
+    uint8_t device;
+    uint8_t addressBusWidth;
+    uint8_t algorithm;
+    uint16_t pageSize;
+    uint8_t profile;
+};
+
+static const struct ChipId KnownChips[] = {
+    {0xBF, 0xB4, 16, OPEN_EEPROM_ALGORITHM_NOR_PROGRAM, 0, OPEN_EEPROM_PROFILE_39SF010}, /* SST39SF512 */
+    {0xBF, 0xB5, 17, OPEN_EEPROM_ALGORITHM_NOR_PROGRAM, 0, OPEN_EEPROM_PROFILE_39SF010}, /* SST39SF010A */
+    {0xBF, 0xB6, 18, OPEN_EEPROM_ALGORITHM_NOR_PROGRAM, 0, OPEN_EEPROM_PROFILE_39SF010}, /* SST39SF020A */
+    {0xBF, 0xB7, 19, OPEN_EEPROM_ALGORITHM_NOR_PROGRAM, 0, OPEN_EEPROM_PROFILE_39SF010}, /* SST39SF040 */
+    {0x01, 0x20, 17, OPEN_EEPROM_ALGORITHM_NOR_PROGRAM, 0, OPEN_EEPROM_PROFILE_29F010},  /* Am29F010 */
+    {0x01, 0xA4, 19, OPEN_EEPROM_ALGORITHM_NOR_PROGRAM, 0, OPEN_EEPROM_PROFILE_29F010},  /* Am29F040 */
+    {0x1F, 0xDC, 15, OPEN_EEPROM_ALGORITHM_PAGE_WRITE, 64, OPEN_EEPROM_PROFILE_28C256},  /* AT29C256 */
+    {0x1F, 0xD5, 17, OPEN_EEPROM_ALGORITHM_PAGE_WRITE, 128, OPEN_EEPROM_PROFILE_28C256}, /* AT29C010A */
+};
+
+/*
+ * March C- on bytes with all-0 and all-1 backgrounds:
+ * up(w0); up(r0,w1); up(r1,w0); down(r0,w1); down(r1,w0); up(r0).
+ * A read or write of -1 means the element has none.
+ */
+struct MarchElement {
+    uint8_t down;
+    int16_t read;
+    int16_t write;
+};
+
+static const struct MarchElement MarchCMinus[] = {
+    {0, -1, 0x00}, {0, 0x00, 0xFF}, {0, 0xFF, 0x00}, 
+    {1, 0x00, 0xFF}, {1, 0xFF, 0x00}, {0, 0x00, -1},
+};
+
+/* Failures found by OpenEEPROM_sramTest so far. */
+struct MemoryTestResult {
+    uint32_t failures;
+    uint8_t tests;
+    uint8_t recorded;
+    char *failed;
+};
+
+static void applyParallelTiming(const struct ParallelTiming *timing);
+static void writeTestByte(uint32_t address, uint8_t data);
+static void checkTestByte(struct MemoryTestResult *result, uint8_t test, 
+        uint32_t address, uint8_t expected);
+static inline uint8_t foldAddress(uint32_t address);
+static void readParallelBytes(uint32_t address, char *buf, size_t count);
+static inline uint32_t readAccessTicks(uint32_t address, int first);
+static int readParallelChecksum(uint32_t address, uint32_t count, uint8_t passes, 
+        uint32_t *checksum);
+static int readNorCfi(uint8_t *deviceSize, uint16_t *bufferSize);
+static void restoreParallelByte(uint32_t address, uint8_t data);
 
 static inline int switchToParallelBusMode(void);
 static inline int switchToSpiBusMode(void);
+static inline int runParallelReadKernel(uint32_t address, char *buf, size_t count);
+static inline int runParallelWriteKernel(uint32_t address, const char *buf, size_t count);
+static inline int runParallelReadCapture(uint32_t address, char *buf, size_t count);
+static inline void writeParallelCycle(uint32_t address, uint8_t data);
+static inline void writeStrobedCycle(uint32_t address, uint8_t data);
+static int canSkipWrite(uint32_t address, uint8_t data);
+static uint32_t writeParallelBytes(uint32_t address, uint32_t count, 
+        const char *data, uint32_t dataLen);
+static int writeParallelPages(uint32_t address, uint32_t count, uint16_t pageSize, uint8_t flags,
+        const char *data, uint32_t dataLen, uint32_t *written, uint32_t *skipped);
+static int writeSpiPages(uint32_t address, uint32_t count, uint16_t pageSize, 
+        uint8_t addressBytes, const char *data, uint32_t dataLen, uint32_t *written);
+static void writeUnlockSequence(const uint8_t *data, size_t count);
+static int pollWriteComplete(uint32_t address, uint8_t data, uint8_t toggleBit, 
+        uint32_t timeout);
+static int runNorCommand(const uint8_t *sequence, size_t count, uint32_t address, 
+        uint8_t data, uint32_t timeout);
+static void resetNorChip(uint32_t address);
+static uint16_t readNorWriteBufferSize(void);
+static uint8_t readParallelCycle(uint32_t address);
+
+/* 
+ * JEDEC command sequences of 28C-series EEPROMs and 29F/39SF/49F 
+ * NOR flash. Upper address bits are dropped on narrower buses and 
+ * ignored by parts that decode fewer of them, which gives the 
+ * 0x1555/0x0AAA and 0x555/0x2AA unlock addresses some chips use.
+ */
+static const uint32_t UnlockAddress[] = {0x5555, 0x2AAA, 0x5555, 0x5555, 0x2AAA, 0x5555};
+static const uint8_t SdpLock[] = {0xAA, 0x55, 0xA0};
+static const uint8_t SdpUnlock[] = {0xAA, 0x55, 0x80, 0xAA, 0x55, 0x20};
+static const uint8_t NorProgram[] = {0xAA, 0x55, 0xA0};
+static const uint8_t NorErase[] = {0xAA, 0x55, 0x80, 0xAA, 0x55};
+static const uint8_t NorBypassEnter[] = {0xAA, 0x55, 0x20};
+static const uint8_t NorBufferAbortReset[] = {0xAA, 0x55, 0xF0};
+static const uint8_t SoftwareIdEntry[] = {0xAA, 0x55, 0x90};
 
 /*******************************************
 ********************************************
@@ -120,16 +267,44 @@ int OpenEEPROM_toggleIO(const char *in, char *out) {
 
     if (state == 0) {
         Programmer_disableIOPins();
-        CurrentBusMode = OPEN_EEPROM_BUS_MODE_NOT_SET;
     } else {
         Programmer_init(); 
     }
+    CurrentBusMode = OPEN_EEPROM_BUS_MODE_NOT_SET;
 
     memcpy(&out[sizeof(OpenEEPROM_ACK)], &CurrentBusMode, sizeof(CurrentBusMode));
 
     return sizeof(OpenEEPROM_ACK) + sizeof(state);
 }
 
+/**
+ * @brief Measure the delay the programmer produces
+ *      for a requested number of nanoseconds.
+ *
+ * This is a self-test of the programmer's delay calibration.
+ * The measurement covers a full bus phase, i.e. the delay
+ * plus the IO access that ends it.
+ *
+ * @param in 32-bit requested delay in nanoseconds
+ *
+ * @param out ACK, 32-bit requested delay and 32-bit 
+ *      measured delay, both in nanoseconds
+ *
+ * @return 9
+ */
+int OpenEEPROM_measureDelay(const char *in, char *out) {
+    uint32_t requested, measured;
+    memcpy(&requested, &in[sizeof(OpenEEPROM_ACK)], sizeof(requested));
+
+    measured = Programmer_measureDelay(requested);
+
+    out[0] = OpenEEPROM_ACK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &requested, sizeof(requested));
+    memcpy(&out[sizeof(OpenEEPROM_ACK) + sizeof(requested)], &measured, sizeof(measured));
+
+    return sizeof(OpenEEPROM_ACK) + sizeof(requested) + sizeof(measured);
+}
+
 /*******************************************
 ********************************************
 *             Parallel Commands            *
@@ -177,14 +352,16 @@ int OpenEEPROM_setAddressBusWidth(const char *in, char *out) {
  * time after setting the address lines 
  * before the data lines can be reliably 
  * read from or written to the desired address.
+ * This sets both tAS and tACC, see 
+ * @ref OpenEEPROM_setParallelTiming.
  *
  * @param in 32-bit wait time in nanoseconds
  *
- * @param out ACK and 32-bit set wait time or
- *      NAK and minimum time supported by 
- *      programmer
+ * @param out ACK and the 32-bit applied wait time,
+ *      raised to the programmer's minimum delay 
+ *      if shorter, or NAK if the time is 0
  *
- * @return 5
+ * @return 5, or 1 on NAK
  *
  */
 int OpenEEPROM_setAddressHoldTime(const char *in, char *out) {
@@ -192,12 +369,14 @@ int OpenEEPROM_setAddressHoldTime(const char *in, char *out) {
     int response_len = sizeof(OpenEEPROM_ACK);
     memcpy(&nsecs, &in[sizeof(OpenEEPROM_ACK)], sizeof(nsecs)); 
 
-    // TODO: check that nsecs is greater than minimum supported by programmer
     if (nsecs > 0) {
         out[0] = OpenEEPROM_ACK;
-        ParallelAddressHoldTime = nsecs;
-        memcpy(&out[sizeof(OpenEEPROM_ACK)], &nsecs, sizeof(nsecs));
-        response_len += sizeof(nsecs);
+        struct ParallelTiming timing = Timing;
+        timing.addressSetup = nsecs;
+        timing.readAccess = nsecs;
+        applyParallelTiming(&timing);
+        memcpy(&out[sizeof(OpenEEPROM_ACK)], &Timing.addressSetup, sizeof(Timing.addressSetup));
+        response_len += sizeof(Timing.addressSetup);
     } else {
         out[0] = OpenEEPROM_NAK;
     }
@@ -213,13 +392,14 @@ int OpenEEPROM_setAddressHoldTime(const char *in, char *out) {
  * a minimum elapsed time to update the 
  * address and data lines; otherwise 
  * reads and writes would be unreliable.
+ * This sets tWP, see @ref OpenEEPROM_setParallelTiming.
  *
  * @param in 32-bit pulse width time in nanoseconds
- * @param out ACK and 32-bit set pulse width time or
- *      NAK and minimum time supported by 
- *      programmer
+ * @param out ACK and the 32-bit applied pulse width 
+ *      time, raised to the programmer's minimum delay 
+ *      if shorter, or NAK if the time is 0
  *
- * @return 5
+ * @return 5, or 1 on NAK
  *
  */
 int OpenEEPROM_setAddressPulseWidthTime(const char *in, char *out) {
@@ -229,9 +409,11 @@ int OpenEEPROM_setAddressPulseWidthTime(const char *in, char *out) {
 
     if (nsecs > 0) {
         out[0] = OpenEEPROM_ACK;
-        ChipEnablePulseWidthTime = nsecs;
-        memcpy(&out[sizeof(OpenEEPROM_ACK)], &nsecs, sizeof(nsecs));
-        response_len += sizeof(nsecs);
+        struct ParallelTiming timing = Timing;
+        timing.writePulse = nsecs;
+        applyParallelTiming(&timing);
+        memcpy(&out[sizeof(OpenEEPROM_ACK)], &Timing.writePulse, sizeof(Timing.writePulse));
+        response_len += sizeof(Timing.writePulse);
     } else {
         out[0] = OpenEEPROM_NAK;
     }
@@ -239,13 +421,357 @@ int OpenEEPROM_setAddressPulseWidthTime(const char *in, char *out) {
     return response_len;
 }
 
+/**
+ * @brief Set all parallel bus timing parameters.
+ *
+ * Each phase of a bus cycle waits only as long as its own 
+ * parameter: tAS between address/data and the write strobe, 
+ * tACC between an address change and reading the data with OE 
+ * held low, tOE between lowering OE and reading the data, tWP 
+ * for the write strobe and tWC for a whole write cycle. 
+ * Values below the programmer's minimum delay are raised to it.
+ *
+ * @param in 32-bit tAS, tACC, tOE, tWP and tWC in nanoseconds.
+ *      tOE and tWC may be 0, and tWP 0 disables bus writes
+ *
+ * @param out ACK and the five applied times, or NAK if tACC is 0
+ *
+ * @return 21, or 1 on NAK
+ */
+int OpenEEPROM_setParallelTiming(const char *in, char *out) {
+    struct ParallelTiming timing;
+    memcpy(&timing, &in[sizeof(OpenEEPROM_ACK)], sizeof(timing)); 
+
+    if (timing.readAccess == 0) {
+        out[0] = OpenEEPROM_NAK;
+        return sizeof(OpenEEPROM_ACK);
+    }
+
+    applyParallelTiming(&timing);
+    out[0] = OpenEEPROM_ACK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &Timing, sizeof(Timing));
+    return sizeof(OpenEEPROM_ACK) + sizeof(Timing);
+}
+
+/**
+ * @brief Set the parallel bus timing of a known chip family.
+ *
+ * See @ref OpenEEPROM_setParallelTiming. Slower speed grades 
+ * should set their timing explicitly.
+ *
+ * @param in 8-bit OpenEEPROM_ParallelProfile
+ *
+ * @param out ACK and the five applied times, or NAK if the 
+ *      profile is unknown
+ *
+ * @return 21, or 1 on NAK
+ */
+int OpenEEPROM_setParallelProfile(const char *in, char *out) {
+    uint8_t profile;
+    memcpy(&profile, &in[sizeof(OpenEEPROM_ACK)], sizeof(profile)); 
+
+    if (profile >= sizeof(Profiles) / sizeof(Profiles[0])) {
+        out[0] = OpenEEPROM_NAK;
+        return sizeof(OpenEEPROM_ACK);
+    }
+
+    applyParallelTiming(&Profiles[profile]);
+    out[0] = OpenEEPROM_ACK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &Timing, sizeof(Timing));
+    return sizeof(OpenEEPROM_ACK) + sizeof(Timing);
+}
+
+/**
+ * @brief Set up page-mode reads.
+ *
+ * Page-mode EPROMs and NOR flash present a new address within 
+ * the current page after the page access time (tPACC), which is 
+ * much shorter than tACC. With page mode on, sequential reads wait 
+ * tACC only for their first address and at each page boundary, and 
+ * tPACC otherwise. The hardware capture and read kernels are not 
+ * used, as they wait tACC for every byte.
+ *
+ * @param in 16-bit page size in bus locations (bytes, or words for 
+ *      word reads), 0 to turn page mode off, followed by 32-bit 
+ *      tPACC in nanoseconds
+ *
+ * @param out ACK, the page size and the applied tPACC (raised to the
+ *      programmer's minimum delay), or NAK if the page size is not 
+ *      a power of two
+ *
+ * @return 7, or 1 on NAK
+ */
+int OpenEEPROM_setPageRead(const char *in, char *out) {
+    uint16_t pageSize;
+    uint32_t nsecs;
+    memcpy(&pageSize, &in[sizeof(OpenEEPROM_ACK)], sizeof(pageSize)); 
+    memcpy(&nsecs, &in[sizeof(OpenEEPROM_ACK) + sizeof(pageSize)], sizeof(nsecs)); 
+
+    if ((pageSize & (pageSize - 1)) != 0) {
+        out[0] = OpenEEPROM_NAK;
+        return sizeof(OpenEEPROM_ACK);
+    }
+
+    PageReadMask = pageSize > 1 ? pageSize - 1 : 0;
+    PageAccessTime = nsecs > Programmer_MinimumDelay ? nsecs : Programmer_MinimumDelay;
+    PageAccessTicks = Programmer_nsToDelayTicks(PageAccessTime);
+
+    out[0] = OpenEEPROM_ACK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &pageSize, sizeof(pageSize));
+    memcpy(&out[sizeof(OpenEEPROM_ACK) + sizeof(pageSize)], &PageAccessTime, 
+            sizeof(PageAccessTime));
+    return sizeof(OpenEEPROM_ACK) + sizeof(pageSize) + sizeof(PageAccessTime);
+}
+
+/**
+ * @brief Identify a connected parallel chip and configure 
+ *      the programmer for it.
+ *
+ * The JEDEC software ID sequence is sent with conservative timing 
+ * and the manufacturer and device IDs are read from addresses 0 
+ * and 1. A known part gets its address bus width and timing 
+ * profile applied. Parts with a write buffer, found in their CFI 
+ * data, are reported with the buffered program algorithm, and 
+ * unknown parts that answer a CFI query get their width from it 
+ * and keep the identify timing.
+ *
+ * Parts without software ID (EPROMs, most EEPROMs, SRAM) take the 
+ * sequence as writes. Their original bytes at 0x5555 and 0x2AAA are 
+ * written back, but write-protect EEPROMs before identifying them.
+ *
+ * @param out ACK followed by 8-bit manufacturer ID, 8-bit device ID, 
+ *      8-bit address bus width, 8-bit OpenEEPROM_ProgramAlgorithm, 
+ *      16-bit page or write buffer size (0 for none) and 8-bit 
+ *      OpenEEPROM_ParallelProfile (0xFF for none), or NAK and the 
+ *      two IDs read if the part is unknown or wider than the address 
+ *      bus (0 if the chip did not enter ID mode). A NAK leaves the 
+ *      previous address bus width and timing in place.
+ *
+ * @return 8, or 3 on NAK
+ */
+int OpenEEPROM_parallelIdentify(const char *in, char *out) {
+    uint8_t manufacturer, device, deviceSize = 0;
+    uint8_t original[4], id[4];
+    uint16_t bufferSize = 0;
+    uint8_t previousWidth = CurrentAddressBusWidth;
+    struct ParallelTiming previous = Timing;
+    const struct ChipId *chip = 0;
+    int identified;
+
+    out[0] = OpenEEPROM_NAK;
+    if (!switchToParallelBusMode()) {
+        return sizeof(OpenEEPROM_ACK);
+    }
+
+    applyParallelTiming(&IdentifyTiming);
+    CurrentAddressBusWidth = Programmer_getAddressPinCount();
+    Programmer_toggleOE(1);
+    Programmer_toggleDataIOMode(0);
+    Programmer_toggleCE(0);
+    original[0] = readParallelCycle(0);
+    original[1] = readParallelCycle(1);
+    original[2] = readParallelCycle(UnlockAddress[0]);
+    original[3] = readParallelCycle(UnlockAddress[1]);
+    Programmer_toggleCE(1);
+
+    Programmer_toggleDataIOMode(1);
+    Programmer_toggleWE(0);
+    writeUnlockSequence(SoftwareIdEntry, sizeof(SoftwareIdEntry));
+    Programmer_toggleWE(1);
+
+    /* A chip busy with a write cycle toggles D6, so the IDs must read back the same twice. */
+    Programmer_toggleDataIOMode(0);
+    Programmer_toggleCE(0);
+    for (uint32_t i = 0; i < sizeof(id); i++) {
+        id[i] = readParallelCycle(i % 2);
+    }
+    Programmer_toggleCE(1);
+    identified = id[0] == id[2] && id[1] == id[3] && 
+        (id[0] != original[0] || id[1] != original[1]);
+
+    if (!identified) {
+        pollWriteComplete(UnlockAddress[2], SoftwareIdEntry[2], 1, OPEN_EEPROM_WRITE_CYCLE_TIMEOUT);
+        restoreParallelByte(UnlockAddress[0], original[2]);
+        restoreParallelByte(UnlockAddress[1], original[3]);
+        Programmer_toggleDataIOMode(0);
+        CurrentAddressBusWidth = previousWidth;
+        applyParallelTiming(&previous);
+        out[sizeof(OpenEEPROM_ACK)] = 0;
+        out[sizeof(OpenEEPROM_ACK) + 1] = 0;
+        return sizeof(OpenEEPROM_ACK) + 2;
+    }
+
+    manufacturer = id[0];
+    device = id[1];
+    /* The reset sequence also exits software ID mode. */
+    Programmer_toggleDataIOMode(1);
+    Programmer_toggleWE(0);
+    writeUnlockSequence(NorBufferAbortReset, sizeof(NorBufferAbortReset));
+    Programmer_toggleWE(1);
+    Programmer_toggleDataIOMode(0);
+
+    for (uint32_t i = 0; i < sizeof(KnownChips) / sizeof(KnownChips[0]); i++) {
+        if (KnownChips[i].manufacturer == manufacturer && KnownChips[i].device == device) {
+            chip = &KnownChips[i];
+        }
+    }
+
+    if (chip == 0 || chip->algorithm != OPEN_EEPROM_ALGORITHM_PAGE_WRITE) {
+        readNorCfi(&deviceSize, &bufferSize);
+    }
+
+    struct ChipId result = {manufacturer, device, deviceSize, 
+        OPEN_EEPROM_ALGORITHM_NOR_PROGRAM, 0, 0xFF};
+    if (chip != 0) {
+        result = *chip;
+        applyParallelTiming(&Profiles[chip->profile]);
+    }
+    if (bufferSize > 1 && bufferSize <= 256) {
+        result.algorithm = OPEN_EEPROM_ALGORITHM_NOR_BUFFER_PROGRAM;
+        result.pageSize = bufferSize;
+    }
+
+    out[sizeof(OpenEEPROM_ACK)] = manufacturer;
+    out[sizeof(OpenEEPROM_ACK) + 1] = device;
+    if (result.addressBusWidth == 0 || result.addressBusWidth > Programmer_getAddressPinCount()) {
+        CurrentAddressBusWidth = previousWidth;
+        applyParallelTiming(&previous);
+        return sizeof(OpenEEPROM_ACK) + 2;
+    }
+
+    CurrentAddressBusWidth = result.addressBusWidth;
+    out[0] = OpenEEPROM_ACK;
+    out[sizeof(OpenEEPROM_ACK) + 2] = result.addressBusWidth;
+    out[sizeof(OpenEEPROM_ACK) + 3] = result.algorithm;
+    memcpy(&out[sizeof(OpenEEPROM_ACK) + 4], &result.pageSize, sizeof(result.pageSize));
+    out[sizeof(OpenEEPROM_ACK) + 4 + sizeof(result.pageSize)] = result.profile;
+
+    return sizeof(OpenEEPROM_ACK) + 5 + sizeof(result.pageSize);
+}
+
+/**
+ * @brief Find the shortest read access time (tACC) a connected 
+ *      chip reads reliably at.
+ *
+ * A region is read at the slowest timing, the larger of the set 
+ * tACC and OPEN_EEPROM_TUNE_SLOW_ACCESS_TIME, to get a reference 
+ * checksum. tACC is then binary searched down to the programmer's 
+ * minimum delay, and a time is good if every one of `passes` reads 
+ * of the region matches the reference. The region should hold 
+ * varied data, since a blank chip reads the same at any speed.
+ * Other timing parameters are left as set; tAS only affects writes 
+ * and is not tuned.
+ *
+ * @param in 32-bit address followed by 32-bit byte count, 8-bit 
+ *      number of passes per time tried, 8-bit safety margin in 
+ *      percent and 8-bit flag to apply the result
+ *
+ * @param out ACK followed by the 32-bit shortest good tACC, the 
+ *      32-bit tACC with the margin added (applied if requested) and 
+ *      the 32-bit reference checksum, or NAK if the byte count is 0, 
+ *      no read access time has been set or the region reads 
+ *      differently at the slowest timing
+ *
+ * @return 13, or 1 on NAK
+ */
+int OpenEEPROM_tuneReadTiming(const char *in, char *out) {
+    uint32_t address, count, reference, checksum;
+    uint8_t passes, margin, apply;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
+    memcpy(&passes, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)], 
+            sizeof(passes));  
+    memcpy(&margin, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(passes)], sizeof(margin));  
+    memcpy(&apply, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(passes) + sizeof(margin)], sizeof(apply));  
+
+    /* An empty region checksums the same at any speed. */
+    if (count == 0 || Timing.readAccess < Programmer_MinimumDelay || 
+            !switchToParallelBusMode()) {
+        out[0] = OpenEEPROM_NAK;
+        return sizeof(OpenEEPROM_ACK);
+    }
+
+    struct ParallelTiming previous = Timing, timing = Timing;
+    uint32_t low = Programmer_MinimumDelay;
+    uint32_t high = Timing.readAccess > OPEN_EEPROM_TUNE_SLOW_ACCESS_TIME ? 
+        Timing.readAccess : OPEN_EEPROM_TUNE_SLOW_ACCESS_TIME;
+
+    timing.readAccess = high;
+    applyParallelTiming(&timing);
+    if (!readParallelChecksum(address, count, 1, &reference) || 
+            !readParallelChecksum(address, count, passes, &checksum) || 
+            checksum != reference) {
+        applyParallelTiming(&previous);
+        out[0] = OpenEEPROM_NAK;
+        return sizeof(OpenEEPROM_ACK);
+    }
+
+    while (low < high) {
+        timing.readAccess = low + (high - low) / 2;
+        applyParallelTiming(&timing);
+        if (readParallelChecksum(address, count, passes, &checksum) && checksum == reference) {
+            high = timing.readAccess;
+        } else {
+            low = timing.readAccess + 1;
+        }
+    }
+
+    uint32_t tuned = high;
+    uint32_t padded = tuned + (tuned / 100) * margin + ((tuned % 100) * margin + 99) / 100;
+    if (apply) {
+        previous.readAccess = padded;
+    }
+    applyParallelTiming(&previous);
+
+    out[0] = OpenEEPROM_ACK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &tuned, sizeof(tuned));
+    memcpy(&out[sizeof(OpenEEPROM_ACK) + sizeof(tuned)], &padded, sizeof(padded));
+    memcpy(&out[sizeof(OpenEEPROM_ACK) + sizeof(tuned) + sizeof(padded)], &reference, 
+            sizeof(reference));
+    return sizeof(OpenEEPROM_ACK) + sizeof(tuned) + sizeof(padded) + sizeof(reference);
+}
+
+/**
+ * @brief Set the options used by parallel writes.
+ *
+ * With OPEN_EEPROM_WRITE_SKIP_EQUAL each location is read first and 
+ * not written if it already holds the data, which saves write cycles
+ * and endurance when reflashing mostly unchanged images.
+ * With OPEN_EEPROM_WRITE_SKIP_ERASED bytes equal to the erased value
+ * (0xFF) are not written, for flash-style parts that were erased.
+ * These apply to parallel writes and parallel page writes.
+ *
+ * With OPEN_EEPROM_WRITE_WE_STROBE single-cycle writes (parallel 
+ * writes and fills without a page size) keep CE low for the whole 
+ * burst and strobe WE for tWP, with nothing to wait for afterwards. 
+ * This is for SRAM and battery-backed NVRAM, which have no internal 
+ * write cycle. Parallel FRAM latches the address on the falling edge 
+ * of CE, so it keeps CE-strobed writes.
+ *
+ * @param in 8-bit OpenEEPROM_WriteFlag options
+ *
+ * @param out ACK and the set options
+ *
+ * @return 2
+ */
+int OpenEEPROM_setParallelWriteFlags(const char *in, char *out) {
+    memcpy(&ParallelWriteFlags, &in[sizeof(OpenEEPROM_ACK)], sizeof(ParallelWriteFlags));
+    out[0] = OpenEEPROM_ACK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &ParallelWriteFlags, sizeof(ParallelWriteFlags));
+    return sizeof(OpenEEPROM_ACK) + sizeof(ParallelWriteFlags);
+}
+
 /**
  * @brief Read n bytes from a connected parallel chip.
  *
+ * Each byte waits tACC, or tPACC within a page when page mode 
+ * is set with @ref OpenEEPROM_setPageRead.
+ *
  * @param in 32-bit address followed by 32-bit read count
  * @param out ACK followed by n bytes if successful or NAK if 
- *      set address hold time is less than minimum supported
- *      by the programmer
+ *      no read access time (tACC) has been set
  *
  * @return 1 + n (n is read count from input or 0)
  */
@@ -255,7 +781,7 @@ int OpenEEPROM_parallelRead(const char *in, char *out) {
     memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
     memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
 
-    if (ParallelAddressHoldTime < Programmer_MinimumDelay || !switchToParallelBusMode()) {
+    if (Timing.readAccess < Programmer_MinimumDelay || !switchToParallelBusMode()) {
         out[0] = OpenEEPROM_NAK;
     } else {
         out[0] = OpenEEPROM_ACK;
@@ -263,11 +789,7 @@ int OpenEEPROM_parallelRead(const char *in, char *out) {
         Programmer_toggleDataIOMode(0);
         Programmer_toggleOE(0);
         Programmer_toggleCE(0);
-        for (size_t i = 0; i < count; i++) {
-            Programmer_setAddress(CurrentAddressBusWidth, address + i);
-            Programmer_delay1ns(ParallelAddressHoldTime);
-            databuf[i] = Programmer_getData();
-        } 
+        readParallelBytes(address, databuf, count);
         Programmer_toggleCE(1);
         Programmer_toggleOE(1);
         response_len += count;
@@ -279,23 +801,30 @@ int OpenEEPROM_parallelRead(const char *in, char *out) {
 /**
  * @brief Write n bytes to a connected parallel chip.
  *
+ * Bytes are skipped according to the options set with
+ * @ref OpenEEPROM_setParallelWriteFlags. The range is compared a 
+ * block at a time before any of the block is written, and each 
+ * block is polled until its last write is done, since a read right 
+ * after a write ends an EEPROM's byte load.
+ *
  * @param in 32-bit address followed by 32-bit read count
  *      followed by n bytes
  *
- * @param out ACK if successful or NAK if either set address hold time 
- *      or set pulse width time are less than minimum supported
- *      by the programmer
+ * @param out ACK if successful, followed by the 32-bit number of 
+ *      skipped write cycles if a skip option is set, or NAK if either 
+ *      set address hold time or set pulse width time are less than 
+ *      minimum supported by the programmer
  *
- * @return 1 
+ * @return 1, or 5 with a skip option set
  */
 int OpenEEPROM_parallelWrite(const char *in, char *out) {
-    uint32_t address, count;
+    uint32_t address, count, skipped = 0;
     int response_len = sizeof(OpenEEPROM_ACK);
     memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
     memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
 
-    if (ParallelAddressHoldTime < Programmer_MinimumDelay || 
-            ChipEnablePulseWidthTime < Programmer_MinimumDelay ||
+    if (Timing.addressSetup < Programmer_MinimumDelay || 
+            Timing.writePulse < Programmer_MinimumDelay ||
             !switchToParallelBusMode()) {
         out[0] = OpenEEPROM_NAK;        
     } else {
@@ -304,116 +833,803 @@ int OpenEEPROM_parallelWrite(const char *in, char *out) {
         Programmer_toggleDataIOMode(1);
         Programmer_toggleOE(1);
         Programmer_toggleWE(0);
-        for (size_t i = 0; i < count; i++) {
-            Programmer_setAddress(CurrentAddressBusWidth, address + i);
-            Programmer_setData(databuf[i]);
-            Programmer_delay1ns(ParallelAddressHoldTime);
-            Programmer_toggleCE(0);
-            Programmer_delay1ns(ChipEnablePulseWidthTime);
-            Programmer_toggleCE(1);
-        }
+        skipped = writeParallelBytes(address, count, databuf, count);
         Programmer_toggleWE(1);
         Programmer_toggleDataIOMode(0);
+        /* Hosts that set no skip option keep the original 1 byte response. */
+        if (ParallelWriteFlags & SKIP_WRITE_FLAGS) {
+            memcpy(&out[sizeof(OpenEEPROM_ACK)], &skipped, sizeof(skipped));
+            response_len += sizeof(skipped);
+        }
     }
 
     return response_len;
 }
 
-
-/*******************************************
-********************************************
-*             SPI Commands                 *
-********************************************
-*******************************************/
-
 /**
- * @brief Set the SPI clock frequency.
+ * @brief Read n words from a connected parallel chip 
+ *      with a 16-bit data bus.
  *
- * @param in 32-bit frequency in Hz
+ * The address is a word address, i.e. the chip's [An:A0] in 
+ * word mode (BYTE# high).
  *
- * @param out ACK and 32-bit set frequency
- *      or NAK and maximum supported frequency 
+ * @param in 32-bit word address followed by 32-bit word count
  *
- * @return 5
- */ 
-int OpenEEPROM_setSpiFrequency(const char *in, char *out) {
-    uint32_t freq;
+ * @param out ACK followed by n 16-bit words if successful, or NAK if 
+ *      the programmer has no 16-bit data bus or no read access 
+ *      time (tACC) has been set
+ *
+ * @return 1 + 2n (n is read count from input or 0)
+ */
+int OpenEEPROM_parallelReadWords(const char *in, char *out) {
+    uint32_t address, count;
     int response_len = sizeof(OpenEEPROM_ACK);
-    memcpy(&freq, &in[sizeof(OpenEEPROM_ACK)], sizeof(freq));
-
-
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
 
-    // TODO: return maximum supported frequency if input frequency is invalid
-    if (switchToSpiBusMode() && Programmer_setSpiClockFreq(freq)) {
-        out[0] = OpenEEPROM_ACK;
-        CurrentSpiFrequency = freq;
-        memcpy(&out[sizeof(OpenEEPROM_ACK)], &freq, sizeof(freq));
-        response_len += sizeof(freq);
-    } else {
+    if (Programmer_getDataPinCount() < 16 || 
+            Timing.readAccess < Programmer_MinimumDelay || 
+            !switchToParallelBusMode()) {
         out[0] = OpenEEPROM_NAK;
+    } else {
+        out[0] = OpenEEPROM_ACK;
+        char *databuf = &out[sizeof(OpenEEPROM_ACK)];
+        Programmer_toggleDataIOMode(0);
+        Programmer_toggleOE(0);
+        Programmer_toggleCE(0);
+        Programmer_setAddress(CurrentAddressBusWidth, address);
+        for (size_t i = 0; i < count; i++) {
+            Programmer_advanceAddress(CurrentAddressBusWidth, address + i);
+            Programmer_delayTicks(readAccessTicks(address + i, i == 0));
+            uint16_t word = Programmer_getDataWord();
+            memcpy(&databuf[i * sizeof(word)], &word, sizeof(word));
+        } 
+        Programmer_toggleCE(1);
+        Programmer_toggleOE(1);
+        response_len += count * sizeof(uint16_t);
     }
-    
+
     return response_len;
 }
 
 /**
- * @brief Set the SPI mode.
- *
- * SPI can be configured for 4 different modes, 
- * depending on whether the clock is active high or low
- * and whether data is sampled on the rising edge and 
- * shifted out on the falling edge or vice-versa.
- *
- * TODO: confirm these modes are correct.
- * The modes are:
- *
- * - Mode 0: Active high clock, regular clock polarity.
- * - Mode 1: Active low clock, regular clock polarity.
- * - Mode 2: Active high clock, inverted clock polarity.
- * - Mode 3: Active low clock, inverted clock polarity.
- *
- * Most devices use mode 0; the programmer may 
- * not support all modes.
- *
- * @param in 8-bit mode
+ * @brief Write n words to a connected parallel chip 
+ *      with a 16-bit data bus.
  *
- * @param out ACK and 8-bit set mode or NAK
- *      and current mode if input is invalid
+ * @param in 32-bit word address followed by 32-bit word count
+ *      followed by n 16-bit words
  *
- * @return 2
+ * @param out ACK if successful or NAK if the programmer has no 16-bit
+ *      data bus, or either set address hold time or set pulse width 
+ *      time are less than minimum supported by the programmer
  *
+ * @return 1 
  */
-int OpenEEPROM_setSpiMode(const char *in, char *out) {
-    uint8_t mode;
-    int response_len = sizeof(OpenEEPROM_ACK);
-    memcpy(&mode, &in[sizeof(OpenEEPROM_ACK)], sizeof(mode));
+int OpenEEPROM_parallelWriteWords(const char *in, char *out) {
+    uint32_t address, count;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
 
-    // TODO: return current mode if input is invalid
-    if (switchToSpiBusMode() && Programmer_setSpiMode(mode)) {
-        out[0] = OpenEEPROM_ACK;
-        CurrentSpiMode = mode;
-        memcpy(&out[sizeof(OpenEEPROM_ACK)], &mode, sizeof(mode));
-        response_len += sizeof(mode);
+    if (Programmer_getDataPinCount() < 16 || 
+            Timing.addressSetup < Programmer_MinimumDelay || 
+            Timing.writePulse < Programmer_MinimumDelay ||
+            !switchToParallelBusMode()) {
+        out[0] = OpenEEPROM_NAK;        
     } else {
-        out[0] = OpenEEPROM_NAK;
+        out[0] = OpenEEPROM_ACK;
+        const char *databuf = &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)];
+        Programmer_toggleDataIOMode(1);
+        Programmer_toggleOE(1);
+        Programmer_toggleWE(0);
+        Programmer_setAddress(CurrentAddressBusWidth, address);
+        for (size_t i = 0; i < count; i++) {
+            uint16_t word;
+            memcpy(&word, &databuf[i * sizeof(word)], sizeof(word));
+            Programmer_advanceAddress(CurrentAddressBusWidth, address + i);
+            Programmer_setDataWord(word);
+            Programmer_delayTicks(AddressSetupTicks);
+            Programmer_startCEPulse(WritePulseTicks);
+            Programmer_waitCEPulse();
+            if (WriteRecoveryTicks != 0) {
+                Programmer_delayTicks(WriteRecoveryTicks);
+            }
+        }
+        Programmer_toggleWE(1);
+        Programmer_toggleDataIOMode(0);
     }
 
-    return response_len;
+    return sizeof(OpenEEPROM_ACK);
 }
 
 /**
- * @brief Return the SPI modes the programmer supports.
+ * @brief Write n bytes to a connected parallel EEPROM a page at a time.
  *
- * The value returned is a mask where each set bit  
- * correponds to a supported SPI mode. The values 
- * correspond to @ref OpenEEPROM_SpiMode. 
+ * Each page is loaded with back-to-back write cycles, within the
+ * chip's byte load window, and completion of its internal write 
+ * is detected by polling DATA# (D7) or the toggle bit (D6) instead
+ * of waiting a worst-case write cycle. Pages start at addresses that
+ * are multiples of the page size, so a write that does not start on
+ * a page boundary loads a partial first page.
  *
- * @param out 8-bit mask of supported SPI modes 
+ * Bytes are skipped according to the options set with
+ * @ref OpenEEPROM_setParallelWriteFlags. The comparison is done 
+ * before each page is loaded, and pages with nothing left to write 
+ * take no write cycle at all.
  *
- * @return 2
+ * @param in 32-bit address followed by 32-bit write count,
+ *      16-bit page size, 8-bit OpenEEPROM_PageWriteFlag options 
+ *      and n bytes
  *
+ * @param out ACK or NAK followed by the 32-bit number of bytes 
+ *      written and the 32-bit number of skipped write cycles. 
+ *      NAK if the timing parameters are less than the minimum 
+ *      supported by the programmer, the page size is not a power 
+ *      of two (or over 256 with write options set), or a write 
+ *      cycle did not complete in time
+ *
+ * @return 9
  */
-int OpenEEPROM_getSupportedSpiModes(const char *in, char *out) {
+int OpenEEPROM_parallelPageWrite(const char *in, char *out) {
+    uint32_t address, count, written = 0, skipped = 0;
+    uint16_t pageSize;
+    uint8_t flags;
+    int success = 0;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
+    memcpy(&pageSize, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)], 
+            sizeof(pageSize));  
+    memcpy(&flags, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pageSize)], sizeof(flags));  
+    const char *databuf = &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pageSize) + sizeof(flags)];
+
+    if (Timing.addressSetup >= Programmer_MinimumDelay && 
+            Timing.writePulse >= Programmer_MinimumDelay &&
+            pageSize != 0 && (pageSize & (pageSize - 1)) == 0 &&
+            (!(ParallelWriteFlags & SKIP_WRITE_FLAGS) || pageSize <= COMPARE_PAGE_SIZE_MAX) &&
+            switchToParallelBusMode()) {
+        Programmer_toggleOE(1);
+        success = writeParallelPages(address, count, pageSize, flags, databuf, count, 
+                &written, &skipped);
+        Programmer_toggleDataIOMode(0);
+    }
+
+    out[0] = success ? OpenEEPROM_ACK : OpenEEPROM_NAK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &written, sizeof(written));
+    memcpy(&out[sizeof(OpenEEPROM_ACK) + sizeof(written)], &skipped, sizeof(skipped));
+
+    return sizeof(OpenEEPROM_ACK) + sizeof(written) + sizeof(skipped);
+}
+
+/**
+ * @brief Fill a range of a connected parallel chip with a 
+ *      repeating pattern.
+ *
+ * The pattern is repeated on the programmer so large ranges can 
+ * be filled (e.g. cleared to 0xFF or to a test pattern) without 
+ * sending every byte. With a page size of 0 every byte is written 
+ * with its own write cycle like @ref OpenEEPROM_parallelWrite 
+ * (e.g. SRAM), otherwise pages are written and polled like 
+ * @ref OpenEEPROM_parallelPageWrite. Write options set with 
+ * @ref OpenEEPROM_setParallelWriteFlags apply to both.
+ *
+ * @param in 32-bit address followed by 32-bit byte count,
+ *      16-bit page size (0 for single write cycles), 8-bit 
+ *      OpenEEPROM_PageWriteFlag options, 8-bit pattern length 
+ *      and the pattern bytes
+ *
+ * @param out ACK or NAK followed by the 32-bit number of bytes 
+ *      written and the 32-bit number of skipped write cycles. 
+ *      NAK on the same conditions as @ref OpenEEPROM_parallelPageWrite
+ *
+ * @return 9
+ */
+int OpenEEPROM_parallelFill(const char *in, char *out) {
+    uint32_t address, count, written = 0, skipped = 0;
+    uint16_t pageSize;
+    uint8_t flags, patternLen;
+    int success = 0;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
+    memcpy(&pageSize, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)], 
+            sizeof(pageSize));  
+    memcpy(&flags, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pageSize)], sizeof(flags));  
+    memcpy(&patternLen, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pageSize) + sizeof(flags)], sizeof(patternLen));  
+    const char *pattern = &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pageSize) + sizeof(flags) + sizeof(patternLen)];
+
+    if (Timing.addressSetup >= Programmer_MinimumDelay && 
+            Timing.writePulse >= Programmer_MinimumDelay &&
+            patternLen != 0 && (pageSize & (pageSize - 1)) == 0 &&
+            (!(ParallelWriteFlags & SKIP_WRITE_FLAGS) || pageSize <= COMPARE_PAGE_SIZE_MAX) &&
+            switchToParallelBusMode()) {
+        Programmer_toggleOE(1);
+        if (pageSize == 0) {
+            Programmer_toggleDataIOMode(1);
+            Programmer_toggleWE(0);
+            skipped = writeParallelBytes(address, count, pattern, patternLen);
+            Programmer_toggleWE(1);
+            written = count;
+            success = 1;
+        } else {
+            success = writeParallelPages(address, count, pageSize, flags, pattern, patternLen, 
+                    &written, &skipped);
+        }
+        Programmer_toggleDataIOMode(0);
+    }
+
+    out[0] = success ? OpenEEPROM_ACK : OpenEEPROM_NAK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &written, sizeof(written));
+    memcpy(&out[sizeof(OpenEEPROM_ACK) + sizeof(written)], &skipped, sizeof(skipped));
+
+    return sizeof(OpenEEPROM_ACK) + sizeof(written) + sizeof(skipped);
+}
+
+/**
+ * @brief Test a connected SRAM or NVRAM on the programmer.
+ *
+ * The selected tests run back to back over the range with CE held 
+ * low, WE-strobed writes and OE-strobed reads, so only the result 
+ * crosses the host link. March C- finds stuck-at, transition and 
+ * coupling faults between cells, the checkerboard finds shorts 
+ * between neighbouring cells and data lines, and address-in-address 
+ * finds address lines that are shorted, open or decoded wrong.
+ * The range is left holding the last test's data.
+ *
+ * @param in 32-bit address followed by 32-bit byte count and 8-bit 
+ *      mask of OpenEEPROM_MemoryTest tests to run
+ *
+ * @param out ACK if every test passed, or NAK followed by the 32-bit 
+ *      number of failed reads, the 8-bit mask of failed tests, the 
+ *      8-bit number of failing addresses reported and up to 
+ *      OPEN_EEPROM_MEMORY_TEST_MAX_FAILURES 32-bit failing addresses.
+ *      Also NAK if the timing parameters are less than the minimum 
+ *      supported by the programmer
+ *
+ * @return 1, or 7 + 4 for each reported failing address
+ */
+int OpenEEPROM_sramTest(const char *in, char *out) {
+    uint32_t address, count;
+    uint8_t tests;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
+    memcpy(&tests, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)], 
+            sizeof(tests));  
+
+    struct MemoryTestResult result = {0, 0, 0, 
+        &out[sizeof(OpenEEPROM_ACK) + sizeof(uint32_t) + 2 * sizeof(uint8_t)]};
+
+    if (Timing.readAccess < Programmer_MinimumDelay ||
+            Timing.writePulse < Programmer_MinimumDelay ||
+            !switchToParallelBusMode()) {
+        out[0] = OpenEEPROM_NAK;
+        return sizeof(OpenEEPROM_ACK);
+    }
+
+    Programmer_toggleOE(1);
+    Programmer_toggleWE(1);
+    Programmer_toggleCE(0);
+
+    if (tests & OPEN_EEPROM_MEMORY_TEST_MARCH_C_MINUS) {
+        for (uint32_t e = 0; e < sizeof(MarchCMinus) / sizeof(MarchCMinus[0]); e++) {
+            const struct MarchElement *element = &MarchCMinus[e];
+            for (uint32_t n = 0; n < count; n++) {
+                uint32_t i = element->down ? count - 1 - n : n;
+                if (element->read >= 0) {
+                    checkTestByte(&result, OPEN_EEPROM_MEMORY_TEST_MARCH_C_MINUS, 
+                            address + i, element->read);
+                }
+                if (element->write >= 0) {
+                    writeTestByte(address + i, element->write);
+                }
+            }
+        }
+    }
+
+    if (tests & OPEN_EEPROM_MEMORY_TEST_CHECKERBOARD) {
+        for (uint32_t pass = 0; pass < 2; pass++) {
+            uint8_t invert = pass ? 0xFF : 0x00;
+            for (uint32_t i = 0; i < count; i++) {
+                writeTestByte(address + i, ((address + i) & 1 ? 0xAA : 0x55) ^ invert);
+            }
+            for (uint32_t i = 0; i < count; i++) {
+                checkTestByte(&result, OPEN_EEPROM_MEMORY_TEST_CHECKERBOARD, 
+                        address + i, ((address + i) & 1 ? 0xAA : 0x55) ^ invert);
+            }
+        }
+    }
+
+    if (tests & OPEN_EEPROM_MEMORY_TEST_ADDRESS) {
+        for (uint32_t i = 0; i < count; i++) {
+            writeTestByte(address + i, foldAddress(address + i));
+        }
+        for (uint32_t i = 0; i < count; i++) {
+            checkTestByte(&result, OPEN_EEPROM_MEMORY_TEST_ADDRESS, 
+                    address + i, foldAddress(address + i));
+        }
+    }
+
+    Programmer_toggleCE(1);
+    Programmer_toggleDataIOMode(0);
+
+    if (result.failures == 0) {
+        out[0] = OpenEEPROM_ACK;
+        return sizeof(OpenEEPROM_ACK);
+    }
+
+    out[0] = OpenEEPROM_NAK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &result.failures, sizeof(result.failures));
+    memcpy(&out[sizeof(OpenEEPROM_ACK) + sizeof(result.failures)], &result.tests, 
+            sizeof(result.tests));
+    memcpy(&out[sizeof(OpenEEPROM_ACK) + sizeof(result.failures) + sizeof(result.tests)], 
+            &result.recorded, sizeof(result.recorded));
+    return sizeof(OpenEEPROM_ACK) + sizeof(result.failures) + sizeof(result.tests) + 
+        sizeof(result.recorded) + sizeof(uint32_t) * result.recorded;
+}
+
+
+/**
+ * @brief Program n bytes of a connected parallel NOR flash.
+ *
+ * Each byte is written with the JEDEC program sequence and the 
+ * chip is polled on the programmer until it has been programmed. 
+ * 0xFF bytes are skipped since programming can only clear bits.
+ * The bytes must have been erased first.
+ *
+ * @param in 32-bit address followed by 32-bit write count
+ *      followed by n bytes
+ *
+ * @param out ACK or NAK followed by the 32-bit number of bytes 
+ *      programmed. NAK if the timing parameters are less than the 
+ *      minimum supported by the programmer or a byte did not 
+ *      finish programming in time
+ *
+ * @return 5
+ */
+int OpenEEPROM_norProgram(const char *in, char *out) {
+    uint32_t address, count, written = 0;
+    int success = 0;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
+    const char *databuf = &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)];
+
+    if (Timing.addressSetup >= Programmer_MinimumDelay && 
+            Timing.writePulse >= Programmer_MinimumDelay &&
+            switchToParallelBusMode()) {
+        success = 1;
+        while (success && written < count) {
+            if ((uint8_t) databuf[written] != 0xFF) {
+                success = runNorCommand(NorProgram, sizeof(NorProgram), address + written,
+                        databuf[written], OPEN_EEPROM_NOR_PROGRAM_TIMEOUT);
+            }
+            if (success) {
+                written++;
+            }
+        }
+    }
+
+    out[0] = success ? OpenEEPROM_ACK : OpenEEPROM_NAK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &written, sizeof(written));
+
+    return sizeof(OpenEEPROM_ACK) + sizeof(written);
+}
+
+/**
+ * @brief Program n bytes of a connected parallel NOR flash 
+ *      in unlock bypass mode.
+ *
+ * For AMD/Fujitsu-style parts that support unlock bypass (20h).
+ * Once in bypass mode each byte takes two write cycles (A0h, data)
+ * instead of four, and the chip is polled after each byte as with
+ * OpenEEPROM_norProgram. Bypass mode is always exited (90h/00h)
+ * before returning.
+ *
+ * @param in 32-bit address followed by 32-bit write count
+ *      followed by n bytes
+ *
+ * @param out ACK or NAK followed by the 32-bit number of bytes 
+ *      programmed. NAK if the timing parameters are less than the 
+ *      minimum supported by the programmer or a byte did not 
+ *      finish programming in time
+ *
+ * @return 5
+ */
+int OpenEEPROM_norBypassProgram(const char *in, char *out) {
+    uint32_t address, count, written = 0;
+    int success = 0;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
+    const char *databuf = &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)];
+
+    if (Timing.addressSetup >= Programmer_MinimumDelay && 
+            Timing.writePulse >= Programmer_MinimumDelay &&
+            switchToParallelBusMode()) {
+        success = 1;
+        Programmer_toggleOE(1);
+        Programmer_toggleDataIOMode(1);
+        Programmer_toggleWE(0);
+        writeUnlockSequence(NorBypassEnter, sizeof(NorBypassEnter));
+        Programmer_toggleWE(1);
+
+        while (success && written < count) {
+            uint8_t data = databuf[written];
+            if (data != 0xFF) {
+                Programmer_toggleDataIOMode(1);
+                Programmer_toggleWE(0);
+                writeParallelCycle(address + written, 0xA0);
+                writeParallelCycle(address + written, data);
+                Programmer_toggleWE(1);
+                success = pollWriteComplete(address + written, data, 1, 
+                        OPEN_EEPROM_NOR_PROGRAM_TIMEOUT);
+            }
+            if (success) {
+                written++;
+            }
+        }
+
+        if (!success) {
+            resetNorChip(address + written);
+        }
+        Programmer_toggleDataIOMode(1);
+        Programmer_toggleWE(0);
+        writeParallelCycle(address, 0x90);
+        writeParallelCycle(address, 0x00);
+        Programmer_toggleWE(1);
+        Programmer_toggleDataIOMode(0);
+    }
+
+    out[0] = success ? OpenEEPROM_ACK : OpenEEPROM_NAK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &written, sizeof(written));
+
+    return sizeof(OpenEEPROM_ACK) + sizeof(written);
+}
+
+/**
+ * @brief Program n bytes of a connected parallel NOR flash 
+ *      through its write buffer.
+ *
+ * The data is split into segments aligned to the write buffer size. 
+ * Each segment is loaded with the write-to-buffer sequence (25h, 
+ * byte count - 1, data) and confirmed (29h) so the chip programs it
+ * in a single internal operation, then polled with DATA#. Segments 
+ * that are all 0xFF are skipped. A segment that fails is followed
+ * by the write-to-buffer abort reset.
+ *
+ * @param in 32-bit address followed by 32-bit write count, 16-bit
+ *      write buffer size in bytes and n bytes. A buffer size of 0 
+ *      reads it from the chip's CFI data
+ *
+ * @param out ACK followed by the 32-bit address after the last byte
+ *      programmed, or NAK followed by the 32-bit address of the
+ *      segment that failed. Also NAK if the timing parameters are 
+ *      less than the minimum supported by the programmer or the 
+ *      buffer size is not a power of two up to 256
+ *
+ * @return 5
+ */
+int OpenEEPROM_norBufferProgram(const char *in, char *out) {
+    uint32_t address, count, written = 0;
+    uint16_t bufferSize;
+    int success = 0;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
+    memcpy(&bufferSize, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)], 
+            sizeof(bufferSize));  
+    const char *databuf = &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(bufferSize)];
+
+    if (Timing.addressSetup >= Programmer_MinimumDelay && 
+            Timing.writePulse >= Programmer_MinimumDelay &&
+            switchToParallelBusMode()) {
+        if (bufferSize == 0) {
+            bufferSize = readNorWriteBufferSize();
+        }
+        success = bufferSize != 0 && bufferSize <= 256 && (bufferSize & (bufferSize - 1)) == 0;
+        Programmer_toggleOE(1);
+
+        while (success && written < count) {
+            uint32_t segment = address + written;
+            uint32_t n = ((segment | (bufferSize - 1)) + 1) - segment;
+            uint32_t erased = 0;
+            if (n > count - written) {
+                n = count - written;
+            }
+            while (erased < n && (uint8_t) databuf[written + erased] == 0xFF) {
+                erased++;
+            }
+
+            if (erased < n) {
+                Programmer_toggleDataIOMode(1);
+                Programmer_toggleWE(0);
+                writeUnlockSequence(NorProgram, 2);
+                writeParallelCycle(segment, 0x25);
+                writeParallelCycle(segment, n - 1);
+                for (uint32_t i = 0; i < n; i++) {
+                    writeParallelCycle(segment + i, databuf[written + i]);
+                }
+                writeParallelCycle(segment, 0x29);
+                Programmer_toggleWE(1);
+
+                success = pollWriteComplete(segment + n - 1, databuf[written + n - 1], 0, 
+                        OPEN_EEPROM_NOR_PROGRAM_TIMEOUT);
+                if (!success) {
+                    Programmer_toggleDataIOMode(1);
+                    Programmer_toggleWE(0);
+                    writeUnlockSequence(NorBufferAbortReset, sizeof(NorBufferAbortReset));
+                    Programmer_toggleWE(1);
+                }
+            }
+            if (success) {
+                written += n;
+            }
+        }
+        Programmer_toggleDataIOMode(0);
+    }
+
+    address += written;
+    out[0] = success ? OpenEEPROM_ACK : OpenEEPROM_NAK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &address, sizeof(address));
+
+    return sizeof(OpenEEPROM_ACK) + sizeof(address);
+}
+
+/**
+ * @brief Program n bytes of a connected UV EPROM with a 
+ *      quick-pulse algorithm.
+ *
+ * Programming voltage is applied with @ref Programmer_toggleVpp
+ * and each byte gets CE program pulses, with OE high, until it
+ * verifies or the pulse limit is reached. A byte that verifies after
+ * X pulses then gets one overprogram pulse of X times the pulse 
+ * width times the overprogram factor. 0xFF bytes are skipped since 
+ * erased bits are already 1.
+ *
+ * @param in 32-bit address followed by 32-bit write count, 16-bit
+ *      pulse width in microseconds, 8-bit maximum pulses per byte, 
+ *      8-bit overprogram factor (0 for none) and n bytes
+ *
+ * @param out ACK if every byte verified, or NAK followed by the 32-bit
+ *      number of failing bytes and up to OPEN_EEPROM_EPROM_MAX_FAILURES
+ *      32-bit failing addresses. Also NAK if the timing parameters 
+ *      are less than the minimum supported by the programmer or the 
+ *      pulse limit is 0
+ *
+ * @return 1, or 5 + 4 for each reported failing address
+ */
+int OpenEEPROM_epromProgram(const char *in, char *out) {
+    uint32_t address, count, failures = 0;
+    uint16_t pulseWidth;
+    uint8_t maxPulses, overprogram;
+    int response_len = sizeof(OpenEEPROM_ACK);
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
+    memcpy(&pulseWidth, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)], 
+            sizeof(pulseWidth));  
+    memcpy(&maxPulses, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pulseWidth)], sizeof(maxPulses));  
+    memcpy(&overprogram, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pulseWidth) + sizeof(maxPulses)], sizeof(overprogram));  
+    const char *databuf = &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pulseWidth) + sizeof(maxPulses) + sizeof(overprogram)];
+
+    if (Timing.addressSetup < Programmer_MinimumDelay || maxPulses == 0 ||
+            !switchToParallelBusMode()) {
+        out[0] = OpenEEPROM_NAK;
+        return response_len;
+    }
+
+    uint32_t pulseTicks = Programmer_nsToDelayTicks(pulseWidth * 1000);
+    char *failed = &out[sizeof(OpenEEPROM_ACK) + sizeof(failures)];
+
+    Programmer_toggleOE(1);
+    Programmer_toggleWE(1);
+    Programmer_toggleVpp(1);
+    Programmer_delay1ns(OPEN_EEPROM_VPP_SETUP_TIME);
+
+    for (uint32_t i = 0; i < count; i++) {
+        uint8_t data = databuf[i];
+        uint8_t pulses = 0;
+        int verified = data == 0xFF;
+
+        while (!verified && pulses < maxPulses) {
+            Programmer_toggleDataIOMode(1);
+            Programmer_advanceAddress(CurrentAddressBusWidth, address + i);
+            Programmer_setData(data);
+            Programmer_delayTicks(AddressSetupTicks);
+            Programmer_startCEPulse(pulseTicks);
+            Programmer_waitCEPulse();
+            pulses++;
+
+            Programmer_toggleDataIOMode(0);
+            Programmer_toggleCE(0);
+            verified = readParallelCycle(address + i) == data;
+            Programmer_toggleCE(1);
+        }
+
+        if (!verified) {
+            if (failures < OPEN_EEPROM_EPROM_MAX_FAILURES) {
+                uint32_t failedAddress = address + i;
+                memcpy(&failed[failures * sizeof(failedAddress)], &failedAddress, 
+                        sizeof(failedAddress));
+            }
+            failures++;
+        } else if (data != 0xFF && overprogram != 0) {
+            uint32_t width = (uint32_t) pulseWidth * pulses * overprogram;
+            if (width > UINT32_MAX / 1000) {
+                width = UINT32_MAX / 1000;
+            }
+            Programmer_toggleDataIOMode(1);
+            Programmer_setData(data);
+            Programmer_delayTicks(AddressSetupTicks);
+            Programmer_startCEPulse(Programmer_nsToDelayTicks(width * 1000));
+            Programmer_waitCEPulse();
+        }
+    }
+
+    Programmer_toggleVpp(0);
+    Programmer_toggleDataIOMode(0);
+
+    if (failures == 0) {
+        out[0] = OpenEEPROM_ACK;
+    } else {
+        out[0] = OpenEEPROM_NAK;
+        memcpy(&out[sizeof(OpenEEPROM_ACK)], &failures, sizeof(failures));
+        response_len += sizeof(failures) + sizeof(uint32_t) * 
+            (failures < OPEN_EEPROM_EPROM_MAX_FAILURES ? failures : OPEN_EEPROM_EPROM_MAX_FAILURES);
+    }
+
+    return response_len;
+}
+
+/**
+ * @brief Erase the sector of a connected parallel NOR flash
+ *      that contains an address.
+ *
+ * @param in 32-bit address within the sector
+ *
+ * @param out ACK if the sector was erased or NAK if the timing 
+ *      parameters are less than the minimum supported by the 
+ *      programmer or the erase did not finish in time
+ *
+ * @return 1
+ */
+int OpenEEPROM_norSectorErase(const char *in, char *out) {
+    uint32_t address;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+
+    if (Timing.addressSetup >= Programmer_MinimumDelay && 
+            Timing.writePulse >= Programmer_MinimumDelay &&
+            switchToParallelBusMode() &&
+            runNorCommand(NorErase, sizeof(NorErase), address, 0x30, 
+                OPEN_EEPROM_NOR_SECTOR_ERASE_TIMEOUT)) {
+        out[0] = OpenEEPROM_ACK;
+    } else {
+        out[0] = OpenEEPROM_NAK;
+    }
+
+    return sizeof(OpenEEPROM_ACK);
+}
+
+/**
+ * @brief Erase a whole connected parallel NOR flash.
+ *
+ * @param out ACK if the chip was erased or NAK if the timing 
+ *      parameters are less than the minimum supported by the 
+ *      programmer or the erase did not finish in time
+ *
+ * @return 1
+ */
+int OpenEEPROM_norChipErase(const char *in, char *out) {
+    if (Timing.addressSetup >= Programmer_MinimumDelay && 
+            Timing.writePulse >= Programmer_MinimumDelay &&
+            switchToParallelBusMode() &&
+            runNorCommand(NorErase, sizeof(NorErase), UnlockAddress[0], 0x10, 
+                OPEN_EEPROM_NOR_CHIP_ERASE_TIMEOUT)) {
+        out[0] = OpenEEPROM_ACK;
+    } else {
+        out[0] = OpenEEPROM_NAK;
+    }
+
+    return sizeof(OpenEEPROM_ACK);
+}
+
+
+/*******************************************
+********************************************
+*             SPI Commands                 *
+********************************************
+*******************************************/
+
+/**
+ * @brief Set the SPI clock frequency.
+ *
+ * @param in 32-bit frequency in Hz
+ *
+ * @param out ACK and 32-bit set frequency
+ *      or NAK and maximum supported frequency 
+ *
+ * @return 5
+ */ 
+int OpenEEPROM_setSpiFrequency(const char *in, char *out) {
+    uint32_t freq;
+    int response_len = sizeof(OpenEEPROM_ACK);
+    memcpy(&freq, &in[sizeof(OpenEEPROM_ACK)], sizeof(freq));
+
+
+
+    // TODO: return maximum supported frequency if input frequency is invalid
+    if (switchToSpiBusMode() && Programmer_setSpiClockFreq(freq)) {
+        out[0] = OpenEEPROM_ACK;
+        CurrentSpiFrequency = freq;
+        memcpy(&out[sizeof(OpenEEPROM_ACK)], &freq, sizeof(freq));
+        response_len += sizeof(freq);
+    } else {
+        out[0] = OpenEEPROM_NAK;
+    }
+    
+    return response_len;
+}
+
+/**
+ * @brief Set the SPI mode.
+ *
+ * SPI can be configured for 4 different modes, 
+ * depending on whether the clock is active high or low
+ * and whether data is sampled on the rising edge and 
+ * shifted out on the falling edge or vice-versa.
+ *
+ * TODO: confirm these modes are correct.
+ * The modes are:
+ *
+ * - Mode 0: Active high clock, regular clock polarity.
+ * - Mode 1: Active low clock, regular clock polarity.
+ * - Mode 2: Active high clock, inverted clock polarity.
+ * - Mode 3: Active low clock, inverted clock polarity.
+ *
+ * Most devices use mode 0; the programmer may 
+ * not support all modes.
+ *
+ * @param in 8-bit mode
+ *
+ * @param out ACK and 8-bit set mode or NAK
+ *      and current mode if input is invalid
+ *
+ * @return 2
+ *
+ */
+int OpenEEPROM_setSpiMode(const char *in, char *out) {
+    uint8_t mode;
+    int response_len = sizeof(OpenEEPROM_ACK);
+    memcpy(&mode, &in[sizeof(OpenEEPROM_ACK)], sizeof(mode));
+
+    // TODO: return current mode if input is invalid
+    if (switchToSpiBusMode() && Programmer_setSpiMode(mode)) {
+        out[0] = OpenEEPROM_ACK;
+        CurrentSpiMode = mode;
+        memcpy(&out[sizeof(OpenEEPROM_ACK)], &mode, sizeof(mode));
+        response_len += sizeof(mode);
+    } else {
+        out[0] = OpenEEPROM_NAK;
+    }
+
+    return response_len;
+}
+
+/**
+ * @brief Return the SPI modes the programmer supports.
+ *
+ * The value returned is a mask where each set bit  
+ * correponds to a supported SPI mode. The values 
+ * correspond to @ref OpenEEPROM_SpiMode. 
+ *
+ * @param out 8-bit mask of supported SPI modes 
+ *
+ * @return 2
+ *
+ */
+int OpenEEPROM_getSupportedSpiModes(const char *in, char *out) {
     out[0] = OpenEEPROM_ACK;
     uint8_t supportedSpiModes = Programmer_getSupportedSpiModes();
     memcpy(&out[sizeof(OpenEEPROM_ACK)], &supportedSpiModes, sizeof(supportedSpiModes));
@@ -454,23 +1670,670 @@ int OpenEEPROM_spiTransmit(const char *in, char *out) {
     return response_len;
 }
 
+/**
+ * @brief Fill a range of a connected 25-series SPI EEPROM or 
+ *      flash with a repeating pattern.
+ *
+ * Each page is written with WREN (0x06) and Page Program (0x02), 
+ * then the status register is read (0x05) until the write in 
+ * progress bit clears. Flash must have been erased first.
+ *
+ * @param in 32-bit address followed by 32-bit byte count,
+ *      16-bit page size (a power of two up to 256), 8-bit number 
+ *      of address bytes (1 to 3), 8-bit pattern length and the 
+ *      pattern bytes
+ *
+ * @param out ACK or NAK followed by the 32-bit number of bytes 
+ *      written. NAK if SPI mode isn't supported, the arguments are
+ *      out of range or a write cycle did not complete in time
+ *
+ * @return 5
+ */
+int OpenEEPROM_spiFill(const char *in, char *out) {
+    uint32_t address, count, written = 0;
+    uint16_t pageSize;
+    uint8_t addressBytes, patternLen;
+    int success = 0;
+    memcpy(&address, &in[sizeof(OpenEEPROM_ACK)], sizeof(address));  
+    memcpy(&count, &in[sizeof(OpenEEPROM_ACK) + sizeof(address)], sizeof(count));  
+    memcpy(&pageSize, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count)], 
+            sizeof(pageSize));  
+    memcpy(&addressBytes, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pageSize)], sizeof(addressBytes));  
+    memcpy(&patternLen, &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pageSize) + sizeof(addressBytes)], sizeof(patternLen));  
+    const char *pattern = &in[sizeof(OpenEEPROM_ACK) + sizeof(address) + sizeof(count) + 
+            sizeof(pageSize) + sizeof(addressBytes) + sizeof(patternLen)];
+
+    if (pageSize != 0 && pageSize <= SPI_PAGE_SIZE_MAX && (pageSize & (pageSize - 1)) == 0 &&
+            addressBytes >= 1 && addressBytes <= 3 && patternLen != 0 &&
+            switchToSpiBusMode()) {
+        success = writeSpiPages(address, count, pageSize, addressBytes, pattern, patternLen, 
+                &written);
+    }
+
+    out[0] = success ? OpenEEPROM_ACK : OpenEEPROM_NAK;
+    memcpy(&out[sizeof(OpenEEPROM_ACK)], &written, sizeof(written));
+
+    return sizeof(OpenEEPROM_ACK) + sizeof(written);
+}
+
 static inline int switchToParallelBusMode(void) {
-    if ((CurrentBusMode != OPEN_EEPROM_BUS_MODE_PARALLEL) && 
-            (OPEN_EEPROM_BUS_MODE_PARALLEL & SupportedBusTypes)) {
-        Programmer_initParallel();
-        return 1;
-    } else {
+    if (!(OPEN_EEPROM_BUS_MODE_PARALLEL & SupportedBusTypes)) {
         return 0;
     }
+    if (CurrentBusMode != OPEN_EEPROM_BUS_MODE_PARALLEL) {
+        Programmer_initParallel();
+        CurrentBusMode = OPEN_EEPROM_BUS_MODE_PARALLEL;
+    }
+    return 1;
 }
 
 static inline int switchToSpiBusMode(void) {
-    if ((CurrentBusMode != OPEN_EEPROM_BUS_MODE_SPI) && 
-            (OPEN_EEPROM_BUS_MODE_SPI & SupportedBusTypes)) {
+    if (!(OPEN_EEPROM_BUS_MODE_SPI & SupportedBusTypes)) {
+        return 0;
+    }
+    if (CurrentBusMode != OPEN_EEPROM_BUS_MODE_SPI) {
         Programmer_initSpi();
+        CurrentBusMode = OPEN_EEPROM_BUS_MODE_SPI;
+    }
+    return 1;
+}
+
+
+/*
+ * Hand a whole read to the programmer's kernel for the current
+ * bus width. Returns 0 if the generic loop should be used instead.
+ */
+static inline int runParallelReadKernel(uint32_t address, char *buf, size_t count) {
+#ifdef OPEN_EEPROM_PARALLEL_KERNELS
+    return Programmer_parallelReadKernel(CurrentAddressBusWidth, address, buf, count, 
+            ReadAccessTicks);
+#else
+    (void) address;
+    (void) buf;
+    (void) count;
+    return 0;
+#endif
+}
+
+/*
+ * Hand a whole read to the programmer's hardware capture engine.
+ * Returns 0 if it cannot take the read.
+ */
+static inline int runParallelReadCapture(uint32_t address, char *buf, size_t count) {
+#ifdef OPEN_EEPROM_PARALLEL_CAPTURE
+    return Programmer_parallelReadCapture(CurrentAddressBusWidth, address, buf, count, 
+            ReadAccessTicks);
+#else
+    (void) address;
+    (void) buf;
+    (void) count;
+    return 0;
+#endif
+}
+
+static inline int runParallelWriteKernel(uint32_t address, const char *buf, size_t count) {
+#ifdef OPEN_EEPROM_PARALLEL_KERNELS
+    /* Kernels strobe back to back, they have no write recovery time. */
+    return WriteRecoveryTicks == 0 && 
+        Programmer_parallelWriteKernel(CurrentAddressBusWidth, address, buf, count, 
+            AddressSetupTicks, WritePulseTicks);
+#else
+    (void) address;
+    (void) buf;
+    (void) count;
+    return 0;
+#endif
+}
+
+/*
+ * One CE-strobed write cycle. WE must already be low 
+ * and the data lines outputs.
+ */
+static inline void writeParallelCycle(uint32_t address, uint8_t data) {
+    Programmer_advanceAddress(CurrentAddressBusWidth, address);
+    Programmer_setData(data);
+    Programmer_delayTicks(AddressSetupTicks);
+    Programmer_startCEPulse(WritePulseTicks);
+    Programmer_waitCEPulse();
+    if (WriteRecoveryTicks != 0) {
+        Programmer_delayTicks(WriteRecoveryTicks);
+    }
+}
+
+/*
+ * One WE-strobed write cycle for parts without an internal write 
+ * cycle. CE must already be low, WE high and the data lines outputs.
+ */
+static inline void writeStrobedCycle(uint32_t address, uint8_t data) {
+    Programmer_advanceAddress(CurrentAddressBusWidth, address);
+    Programmer_setData(data);
+    Programmer_delayTicks(AddressSetupTicks);
+    Programmer_toggleWE(0);
+    Programmer_delayTicks(WritePulseTicks);
+    Programmer_toggleWE(1);
+    if (WriteRecoveryTicks != 0) {
+        Programmer_delayTicks(WriteRecoveryTicks);
+    }
+}
+
+/*
+ * Whether writing `data` to `address` can be skipped under the 
+ * current write options. Reads the location with WE high and 
+ * leaves the data lines as inputs when it has to compare.
+ */
+static int canSkipWrite(uint32_t address, uint8_t data) {
+    if ((ParallelWriteFlags & OPEN_EEPROM_WRITE_SKIP_ERASED) && data == 0xFF) {
         return 1;
-    } else {
+    }
+    if (ParallelWriteFlags & OPEN_EEPROM_WRITE_SKIP_EQUAL) {
+        uint8_t current;
+        Programmer_toggleWE(1);
+        Programmer_toggleDataIOMode(0);
+        Programmer_toggleCE(0);
+        current = readParallelCycle(address);
+        if (!(ParallelWriteFlags & OPEN_EEPROM_WRITE_WE_STROBE)) {
+            Programmer_toggleCE(1);
+        }
+        return current == data;
+    }
+    return 0;
+}
+
+static void writeUnlockSequence(const uint8_t *data, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        writeParallelCycle(UnlockAddress[i], data[i]);
+    }
+}
+
+/*
+ * Wait for an internal write cycle to end by reading back the last
+ * byte written. While the cycle runs D7 reads back as the complement
+ * of the written data, and D6 toggles on every read. 
+ *
+ * Returns 0 if the cycle is still running after `timeout` microseconds.
+ */
+static int pollWriteComplete(uint32_t address, uint8_t data, uint8_t toggleBit, 
+        uint32_t timeout) {
+    const uint32_t pollTicks = Programmer_nsToDelayTicks(1000);
+    uint8_t previous = 0, current;
+    int done = 0;
+
+    Programmer_toggleDataIOMode(0);
+    Programmer_toggleCE(0);
+
+    for (uint32_t us = 0; !done && us <= timeout; us++) {
+        current = readParallelCycle(address);
+
+        if (toggleBit) {
+            done = us > 0 && ((current ^ previous) & 0x40) == 0;
+        } else {
+            done = (current & 0x80) == (data & 0x80);
+        }
+        previous = current;
+
+        if (!done) {
+            Programmer_delayTicks(pollTicks);
+        }
+    }
+
+    Programmer_toggleCE(1);
+
+    return done;
+}
+
+/*
+ * Issue a NOR flash command: an unlock/setup sequence followed by 
+ * one final write cycle, then toggle-bit poll until the chip's
+ * embedded algorithm is done. A chip that does not finish is
+ * sent the reset command to return it to read mode.
+ */
+static int runNorCommand(const uint8_t *sequence, size_t count, uint32_t address, 
+        uint8_t data, uint32_t timeout) {
+    int done;
+
+    Programmer_toggleOE(1);
+    Programmer_toggleDataIOMode(1);
+    Programmer_toggleWE(0);
+    writeUnlockSequence(sequence, count);
+    writeParallelCycle(address, data);
+    Programmer_toggleWE(1);
+
+    done = pollWriteComplete(address, data, 1, timeout);
+
+    if (!done) {
+        resetNorChip(address);
+    }
+    Programmer_toggleDataIOMode(0);
+
+    return done;
+}
+
+/*
+ * Send the NOR reset command, which returns a chip 
+ * that failed an embedded algorithm to read mode.
+ */
+static void resetNorChip(uint32_t address) {
+    Programmer_toggleDataIOMode(1);
+    Programmer_toggleWE(0);
+    writeParallelCycle(address, 0xF0);
+    Programmer_toggleWE(1);
+}
+
+/*
+ * Store bus timing and pre-compute the delay of each phase. 
+ * The address and strobe times the programmer cannot go below 
+ * are raised to its minimum delay. A read cycle that lowers OE 
+ * right after changing the address waits for the longer of tACC 
+ * and tOE, and a write cycle is padded out to tWC after its strobe.
+ */
+static void applyParallelTiming(const struct ParallelTiming *timing) {
+    Timing = *timing;
+    if (Timing.addressSetup < Programmer_MinimumDelay) {
+        Timing.addressSetup = Programmer_MinimumDelay;
+    }
+    if (Timing.readAccess < Programmer_MinimumDelay) {
+        Timing.readAccess = Programmer_MinimumDelay;
+    }
+    if (Timing.writePulse != 0 && Timing.writePulse < Programmer_MinimumDelay) {
+        Timing.writePulse = Programmer_MinimumDelay;
+    }
+
+    AddressSetupTicks = Programmer_nsToDelayTicks(Timing.addressSetup);
+    ReadAccessTicks = Programmer_nsToDelayTicks(Timing.readAccess);
+    ReadCycleTicks = Programmer_nsToDelayTicks(Timing.readAccess > Timing.outputEnable ? 
+            Timing.readAccess : Timing.outputEnable);
+    WritePulseTicks = Programmer_nsToDelayTicks(Timing.writePulse);
+    WriteRecoveryTicks = Timing.writeCycle > Timing.addressSetup + Timing.writePulse ? 
+        Programmer_nsToDelayTicks(Timing.writeCycle - Timing.addressSetup - Timing.writePulse) : 0;
+}
+
+/*
+ * Read `count` bytes with OE and CE held low, through the hardware 
+ * capture or a kernel when available. CE and OE must already be 
+ * low and the data lines inputs.
+ */
+static void readParallelBytes(uint32_t address, char *buf, size_t count) {
+    /* Capture and kernels wait tACC for every byte, page mode is faster. */
+    if (PageReadMask == 0 && (runParallelReadCapture(address, buf, count) || 
+                runParallelReadKernel(address, buf, count))) {
+        return;
+    }
+
+    Programmer_setAddress(CurrentAddressBusWidth, address);
+    for (size_t i = 0; i < count; i++) {
+        Programmer_advanceAddress(CurrentAddressBusWidth, address + i);
+        Programmer_delayTicks(readAccessTicks(address + i, i == 0));
+        buf[i] = Programmer_getData();
+    } 
+}
+
+/*
+ * Delay before reading `address` with OE held low. Only the first 
+ * address and page boundaries need the full tACC in page mode, 
+ * since stepping within a page only changes the low address lines.
+ */
+static inline uint32_t readAccessTicks(uint32_t address, int first) {
+    if (PageReadMask == 0 || first || (address & PageReadMask) == 0) {
+        return ReadAccessTicks;
+    }
+    return PageAccessTicks;
+}
+
+/*
+ * Read a region `passes` times with the current timing and 
+ * checksum it. Returns 0 if the passes did not all agree.
+ */
+static int readParallelChecksum(uint32_t address, uint32_t count, uint8_t passes, 
+        uint32_t *checksum) {
+    static char chunk[64];
+    int stable = 1;
+
+    Programmer_toggleDataIOMode(0);
+    Programmer_toggleWE(1);
+    Programmer_toggleOE(0);
+    Programmer_toggleCE(0);
+    for (uint8_t pass = 0; pass < passes || pass == 0; pass++) {
+        uint32_t sum = 0;
+        for (uint32_t done = 0; done < count; done += sizeof(chunk)) {
+            uint32_t n = count - done < sizeof(chunk) ? count - done : sizeof(chunk);
+            readParallelBytes(address + done, chunk, n);
+            /* Rotating keeps swapped or shifted bytes from cancelling out. */
+            for (uint32_t i = 0; i < n; i++) {
+                sum = ((sum << 1) | (sum >> 31)) ^ (uint8_t) chunk[i];
+            }
+        }
+        if (pass > 0 && sum != *checksum) {
+            stable = 0;
+        }
+        *checksum = sum;
+    }
+    Programmer_toggleCE(1);
+    Programmer_toggleOE(1);
+
+    return stable;
+}
+
+/* 
+ * Memory test write. CE must already be low and WE and OE high. 
+ */
+static void writeTestByte(uint32_t address, uint8_t data) {
+    Programmer_toggleDataIOMode(1);
+    writeStrobedCycle(address, data);
+}
+
+/*
+ * Memory test read. Counts a mismatch against `test` and records the 
+ * address, unless it is already in the list: March C- reads each cell 
+ * several times and the tests revisit it, so a few bad cells would 
+ * otherwise fill the list by themselves.
+ */
+static void checkTestByte(struct MemoryTestResult *result, uint8_t test, 
+        uint32_t address, uint8_t expected) {
+    uint32_t recordedAddress;
+    uint8_t i;
+
+    Programmer_toggleDataIOMode(0);
+    if (readParallelCycle(address) == expected) {
+        return;
+    }
+
+    result->failures++;
+    result->tests |= test;
+    if (result->recorded >= OPEN_EEPROM_MEMORY_TEST_MAX_FAILURES) {
+        return;
+    }
+    for (i = 0; i < result->recorded; i++) {
+        memcpy(&recordedAddress, &result->failed[i * sizeof(recordedAddress)], 
+                sizeof(recordedAddress));
+        if (recordedAddress == address) {
+            return;
+        }
+    }
+    memcpy(&result->failed[result->recorded * sizeof(address)], &address, sizeof(address));
+    result->recorded++;
+}
+
+/* Fold every address bit into a byte, for the address-in-address test. */
+static inline uint8_t foldAddress(uint32_t address) {
+    return address ^ (address >> 8) ^ (address >> 16) ^ (address >> 24);
+}
+
+static uint8_t readParallelCycle(uint32_t address) {
+    uint8_t data;
+
+    Programmer_advanceAddress(CurrentAddressBusWidth, address);
+    Programmer_toggleOE(0);
+    Programmer_delayTicks(ReadCycleTicks);
+    data = Programmer_getData();
+    Programmer_toggleOE(1);
+
+    return data;
+}
+
+/*
+ * Read the maximum write buffer size from a NOR chip's CFI data.
+ *
+ * Returns 0 if the chip has no CFI data or no write buffer.
+ */
+static uint16_t readNorWriteBufferSize(void) {
+    uint8_t deviceSize;
+    uint16_t bufferSize = 0;
+
+    readNorCfi(&deviceSize, &bufferSize);
+
+    return bufferSize;
+}
+
+/*
+ * Read the device size (as a power of two in bytes) and the maximum 
+ * write buffer size from a NOR chip's CFI data. x8 parts answer the 
+ * query at 0x55 with byte addresses, x8/x16 parts in byte mode at 
+ * 0xAA with every address doubled.
+ *
+ * Returns 0 and leaves the outputs untouched if the chip has no CFI data.
+ */
+static int readNorCfi(uint8_t *deviceSize, uint16_t *bufferSize) {
+    const uint32_t entry[] = {0x55, 0xAA};
+    int found = 0;
+
+    for (uint32_t shift = 0; shift < 2 && !found; shift++) {
+        Programmer_toggleDataIOMode(1);
+        Programmer_toggleWE(0);
+        writeParallelCycle(entry[shift], 0x98);
+        Programmer_toggleWE(1);
+        Programmer_toggleDataIOMode(0);
+
+        Programmer_toggleCE(0);
+        if (readParallelCycle(0x10 << shift) == 'Q' && 
+                readParallelCycle(0x11 << shift) == 'R' &&
+                readParallelCycle(0x12 << shift) == 'Y') {
+            uint8_t n = readParallelCycle(0x2A << shift);
+            *bufferSize = (n > 0 && n <= 8) ? 1 << n : 0;
+            *deviceSize = readParallelCycle(0x27 << shift);
+            found = 1;
+        }
+        Programmer_toggleCE(1);
+
+        resetNorChip(0);
+    }
+    Programmer_toggleDataIOMode(0);
+
+    return found;
+}
+
+/*
+ * Write a byte back after a command sequence may have changed it
+ * and wait for the write cycle of EEPROM-like parts to end. 
+ */
+static void restoreParallelByte(uint32_t address, uint8_t data) {
+    Programmer_toggleDataIOMode(1);
+    Programmer_toggleWE(0);
+    writeParallelCycle(address, data);
+    Programmer_toggleWE(1);
+    pollWriteComplete(address, data, 1, OPEN_EEPROM_WRITE_CYCLE_TIMEOUT);
+}
+
+/*
+ * Write `count` bytes with one write cycle each, honouring the write 
+ * options. Byte i comes from data[i % dataLen], so a short `data` 
+ * repeats as a pattern. WE must already be low, OE high and the data
+ * lines outputs. Returns the number of skipped write cycles.
+ *
+ * With a skip option the range is compared a block at a time before 
+ * any of the block is written, and CE-strobed writes are polled until 
+ * the block's last write is done. A read right after a write ends an
+ * EEPROM's byte load and reads DATA# polling data, not the cell.
+ */
+static uint32_t writeParallelBytes(uint32_t address, uint32_t count, 
+        const char *data, uint32_t dataLen) {
+    const int strobeWE = ParallelWriteFlags & OPEN_EEPROM_WRITE_WE_STROBE;
+    const int compare = ParallelWriteFlags & SKIP_WRITE_FLAGS;
+    uint32_t skipped = 0;
+
+    if (ParallelWriteFlags == 0 && dataLen >= count && 
+            runParallelWriteKernel(address, data, count)) {
         return 0;
     }
+
+    if (strobeWE) {
+        Programmer_toggleWE(1);
+        Programmer_toggleCE(0);
+    }
+    for (uint32_t start = 0; start < count; start += COMPARE_PAGE_SIZE_MAX) {
+        uint32_t n = count - start < COMPARE_PAGE_SIZE_MAX ? count - start : COMPARE_PAGE_SIZE_MAX;
+        uint8_t load[COMPARE_PAGE_SIZE_MAX / 8];
+        uint32_t loaded = n, last = n - 1;
+
+        if (compare) {
+            loaded = 0;
+            for (uint32_t i = 0; i < sizeof(load); i++) {
+                load[i] = 0;
+            }
+            for (uint32_t i = 0; i < n; i++) {
+                if (!canSkipWrite(address + start + i, data[(start + i) % dataLen])) {
+                    load[i / 8] |= 1 << (i % 8);
+                    loaded++;
+                    last = i;
+                }
+            }
+            skipped += n - loaded;
+            if (loaded == 0) {
+                continue;
+            }
+            Programmer_toggleDataIOMode(1);
+            if (!strobeWE) {
+                Programmer_toggleWE(0);
+            }
+        }
+
+        Programmer_setAddress(CurrentAddressBusWidth, address + start);
+        for (uint32_t i = 0; i < n; i++) {
+            uint8_t value = data[(start + i) % dataLen];
+            if (loaded < n && !(load[i / 8] & (1 << (i % 8)))) {
+                continue;
+            }
+            if (strobeWE) {
+                writeStrobedCycle(address + start + i, value);
+            } else {
+                writeParallelCycle(address + start + i, value);
+            }
+        }
+
+        if (compare && !strobeWE) {
+            Programmer_toggleWE(1);
+            pollWriteComplete(address + start + last, data[(start + last) % dataLen], 0, 
+                    OPEN_EEPROM_WRITE_CYCLE_TIMEOUT);
+        }
+    }
+    if (strobeWE) {
+        Programmer_toggleCE(1);
+    }
+
+    return skipped;
+}
+
+/*
+ * Page write loop behind OpenEEPROM_parallelPageWrite, with byte i 
+ * taken from data[i % dataLen]. OE must already be high.
+ * Returns 0 if a page did not finish its write cycle in time.
+ */
+static int writeParallelPages(uint32_t address, uint32_t count, uint16_t pageSize, uint8_t flags,
+        const char *data, uint32_t dataLen, uint32_t *written, uint32_t *skipped) {
+    int success = 1;
+
+    if (flags & OPEN_EEPROM_PAGE_WRITE_SDP_UNLOCK) {
+        Programmer_toggleDataIOMode(1);
+        Programmer_toggleWE(0);
+        writeUnlockSequence(SdpUnlock, sizeof(SdpUnlock));
+        Programmer_toggleWE(1);
+        /* Disabling protection takes a write cycle with nothing to poll. */
+        Programmer_delay1ns(OPEN_EEPROM_WRITE_CYCLE_TIMEOUT * 1000);
+    }
+
+    while (success && *written < count) {
+        uint32_t page = address + *written;
+        uint32_t n = ((page | (pageSize - 1)) + 1) - page;
+        uint8_t load[COMPARE_PAGE_SIZE_MAX / 8];
+        if (n > count - *written) {
+            n = count - *written;
+        }
+        uint32_t loaded = n, last = n - 1;
+
+        /* Compare the page before loading it, reads would end the load window. */
+        if (ParallelWriteFlags & SKIP_WRITE_FLAGS) {
+            loaded = 0;
+            for (uint32_t i = 0; i < sizeof(load); i++) {
+                load[i] = 0;
+            }
+            for (uint32_t i = 0; i < n; i++) {
+                if (!canSkipWrite(page + i, data[(*written + i) % dataLen])) {
+                    load[i / 8] |= 1 << (i % 8);
+                    loaded++;
+                    last = i;
+                }
+            }
+            *skipped += n - loaded;
+            if (loaded == 0) {
+                *written += n;
+                continue;
+            }
+        }
+
+        Programmer_toggleDataIOMode(1);
+        Programmer_toggleWE(0);
+        if (flags & OPEN_EEPROM_PAGE_WRITE_SDP_LOCK) {
+            writeUnlockSequence(SdpLock, sizeof(SdpLock));
+        }
+        if (loaded < n) {
+            for (uint32_t i = 0; i < n; i++) {
+                if (load[i / 8] & (1 << (i % 8))) {
+                    writeParallelCycle(page + i, data[(*written + i) % dataLen]);
+                }
+            }
+        } else if (*written + n > dataLen || 
+                !runParallelWriteKernel(page, &data[*written], n)) {
+            for (uint32_t i = 0; i < n; i++) {
+                writeParallelCycle(page + i, data[(*written + i) % dataLen]);
+            }
+        }
+        Programmer_toggleWE(1);
+
+        success = pollWriteComplete(page + last, data[(*written + last) % dataLen], 
+                flags & OPEN_EEPROM_PAGE_WRITE_TOGGLE_BIT, OPEN_EEPROM_WRITE_CYCLE_TIMEOUT);
+        if (success) {
+            *written += n;
+        }
+    }
+
+    return success;
 }
 
+/*
+ * Page program loop behind OpenEEPROM_spiFill. Frames are built in 
+ * static buffers since Programmer_spiTransmit frames one transfer 
+ * with CS. Returns 0 if a page did not finish its write cycle in time.
+ */
+static int writeSpiPages(uint32_t address, uint32_t count, uint16_t pageSize, 
+        uint8_t addressBytes, const char *data, uint32_t dataLen, uint32_t *written) {
+    static char txbuf[1 + 3 + SPI_PAGE_SIZE_MAX], rxbuf[1 + 3 + SPI_PAGE_SIZE_MAX];
+    const char writeEnable[] = {0x06};
+    const char readStatus[] = {0x05, 0x00};
+    int success = 1;
+
+    while (success && *written < count) {
+        uint32_t page = address + *written;
+        uint32_t n = ((page | (pageSize - 1)) + 1) - page;
+        uint32_t len = 0;
+        if (n > count - *written) {
+            n = count - *written;
+        }
+
+        txbuf[len++] = 0x02;
+        for (int i = addressBytes - 1; i >= 0; i--) {
+            txbuf[len++] = (page >> (8 * i)) & 0xFF;
+        }
+        for (uint32_t i = 0; i < n; i++) {
+            txbuf[len++] = data[(*written + i) % dataLen];
+        }
+
+        Programmer_spiTransmit(writeEnable, rxbuf, sizeof(writeEnable));
+        Programmer_spiTransmit(txbuf, rxbuf, len);
+
+        success = 0;
+        for (uint32_t t = 0; t < OPEN_EEPROM_WRITE_CYCLE_TIMEOUT; t++) {
+            Programmer_spiTransmit(readStatus, rxbuf, sizeof(readStatus));
+            if (!(rxbuf[1] & 0x01)) {
+                success = 1;
+                break;
+            }
+            Programmer_delay1ns(1000);
+        }
+        if (success) {
+            *written += n;
+        }
+    }
+
+    return success;
+}
@@ -12,6 +12,7 @@
  */
 
 #include "open-eeprom.h"
+#include "open-eeprom_conf.h"
 #include "open-eeprom_server.h"
 #include "programmer.h"
 #include "transport.h"
@@ -39,6 +40,25 @@ static int (*Commands[])(const char *in, char *out) = {
     OpenEEPROM_setSpiMode,
     OpenEEPROM_getSupportedSpiModes,
     OpenEEPROM_spiTransmit,
+    OpenEEPROM_measureDelay,
+    OpenEEPROM_parallelPageWrite,
+    OpenEEPROM_norProgram,
+    OpenEEPROM_norSectorErase,
+    OpenEEPROM_norChipErase,
+    OpenEEPROM_norBypassProgram,
+    OpenEEPROM_norBufferProgram,
+    OpenEEPROM_epromProgram,
+    OpenEEPROM_parallelReadWords,
+    OpenEEPROM_parallelWriteWords,
+    OpenEEPROM_setParallelWriteFlags,
+    OpenEEPROM_parallelFill,
+    OpenEEPROM_spiFill,
+    OpenEEPROM_setParallelTiming,
+    OpenEEPROM_setParallelProfile,
+    OpenEEPROM_parallelIdentify,
+    OpenEEPROM_tuneReadTiming,
+    OpenEEPROM_sramTest,
+    OpenEEPROM_setPageRead,
 };
 
 static int parseCommand(void);
@@ -193,11 +213,15 @@ static int parseCommand(void) {
         case OPEN_EEPROM_CMD_GET_MAX_TX_SIZE:
         case OPEN_EEPROM_CMD_GET_SUPPORTED_BUS_TYPES:
         case OPEN_EEPROM_CMD_GET_SUPPORTED_SPI_MODES:
+        case OPEN_EEPROM_CMD_NOR_CHIP_ERASE:
+        case OPEN_EEPROM_CMD_PARALLEL_IDENTIFY:
             break;
 
         case OPEN_EEPROM_CMD_TOGGLE_IO:
         case OPEN_EEPROM_CMD_SET_ADDRESS_BUS_WIDTH:
         case OPEN_EEPROM_CMD_SET_SPI_MODE:
+        case OPEN_EEPROM_CMD_SET_PARALLEL_WRITE_FLAGS:
+        case OPEN_EEPROM_CMD_SET_PARALLEL_PROFILE:
             Transport_getData(&RxBuf[idx], 1);
             idx++;
             break;
@@ -205,11 +229,15 @@ static int parseCommand(void) {
         case OPEN_EEPROM_CMD_SET_ADDRESS_HOLD_TIME:
         case OPEN_EEPROM_CMD_SET_PULSE_WIDTH_TIME:
         case OPEN_EEPROM_CMD_SET_SPI_CLOCK_FREQ:
+        case OPEN_EEPROM_CMD_MEASURE_DELAY:
+        case OPEN_EEPROM_CMD_NOR_SECTOR_ERASE:
             Transport_getData(&RxBuf[idx], 4);
             idx += 4;  
             break;
 
         case OPEN_EEPROM_CMD_PARALLEL_WRITE:   
+        case OPEN_EEPROM_CMD_NOR_PROGRAM:
+        case OPEN_EEPROM_CMD_NOR_BYPASS_PROGRAM:
             Transport_getData(&RxBuf[idx], 4);
             idx += 4;
             Transport_getData(&RxBuf[idx], 4);
@@ -226,6 +254,99 @@ static int parseCommand(void) {
 
             break;
 
+        case OPEN_EEPROM_CMD_PARALLEL_PAGE_WRITE:   
+            Transport_getData(&RxBuf[idx], 4);
+            idx += 4;
+            Transport_getData(&RxBuf[idx], 4);
+            memcpy(&nLen, &RxBuf[idx], sizeof(nLen));
+            idx += 4;
+            Transport_getData(&RxBuf[idx], 3);
+            idx += 3;
+            
+            // Account for the 12 bytes already inside the buffer.
+            if (nLen + 12 > RxBufSize) {
+                validCmd = 0;
+            } else {
+                Transport_getData(&RxBuf[idx], nLen);
+                idx += nLen;
+            }
+
+            break;
+
+        case OPEN_EEPROM_CMD_SET_PAGE_READ:
+            Transport_getData(&RxBuf[idx], 6);
+            idx += 6;
+            break;
+
+        case OPEN_EEPROM_CMD_SRAM_TEST:
+            Transport_getData(&RxBuf[idx], 9);
+            idx += 9;
+            break;
+
+        case OPEN_EEPROM_CMD_TUNE_READ_TIMING:
+            Transport_getData(&RxBuf[idx], 11);
+            idx += 11;
+            break;
+
+        case OPEN_EEPROM_CMD_SET_PARALLEL_TIMING:
+            Transport_getData(&RxBuf[idx], 20);
+            idx += 20;
+            break;
+
+        case OPEN_EEPROM_CMD_PARALLEL_FILL:   
+        case OPEN_EEPROM_CMD_SPI_FILL:   
+            Transport_getData(&RxBuf[idx], 12);
+            idx += 12;
+            nLen = (uint8_t) RxBuf[12];
+            
+            // Account for the 13 bytes already inside the buffer.
+            if (nLen == 0 || nLen > OPEN_EEPROM_FILL_PATTERN_MAX || nLen + 13 > RxBufSize) {
+                validCmd = 0;
+            } else {
+                Transport_getData(&RxBuf[idx], nLen);
+                idx += nLen;
+            }
+
+            break;
+
+        case OPEN_EEPROM_CMD_EPROM_PROGRAM:   
+            Transport_getData(&RxBuf[idx], 4);
+            idx += 4;
+            Transport_getData(&RxBuf[idx], 4);
+            memcpy(&nLen, &RxBuf[idx], sizeof(nLen));
+            idx += 4;
+            Transport_getData(&RxBuf[idx], 4);
+            idx += 4;
+            
+            // Account for the 13 bytes already inside the buffer.
+            if (nLen + 13 > RxBufSize) {
+                validCmd = 0;
+            } else {
+                Transport_getData(&RxBuf[idx], nLen);
+                idx += nLen;
+            }
+
+            break;
+
+        case OPEN_EEPROM_CMD_NOR_BUFFER_PROGRAM:   
+            Transport_getData(&RxBuf[idx], 4);
+            idx += 4;
+            Transport_getData(&RxBuf[idx], 4);
+            memcpy(&nLen, &RxBuf[idx], sizeof(nLen));
+            idx += 4;
+            Transport_getData(&RxBuf[idx], 2);
+            idx += 2;
+            
+            // Account for the 11 bytes already inside the buffer.
+            if (nLen + 11 > RxBufSize) {
+                validCmd = 0;
+            } else {
+                Transport_getData(&RxBuf[idx], nLen);
+                idx += nLen;
+            }
+
+            break;
+
         case OPEN_EEPROM_CMD_PARALLEL_READ:   
             Transport_getData(&RxBuf[idx], 4);
             idx += 4;
@@ -240,6 +361,37 @@ static int parseCommand(void) {
             
             break;
 
+        case OPEN_EEPROM_CMD_PARALLEL_READ_WORDS:   
+            Transport_getData(&RxBuf[idx], 4);
+            idx += 4;
+            Transport_getData(&RxBuf[idx], 4);
+            memcpy(&nLen, &RxBuf[idx], sizeof(nLen));
+            idx += 4;
+
+            // Account for the status byte inside the buffer.
+            if (nLen > (TxBufSize - 1) / 2) {
+                validCmd = 0;
+            }
+            
+            break;
+
+        case OPEN_EEPROM_CMD_PARALLEL_WRITE_WORDS:   
+            Transport_getData(&RxBuf[idx], 4);
+            idx += 4;
+            Transport_getData(&RxBuf[idx], 4);
+            memcpy(&nLen, &RxBuf[idx], sizeof(nLen));
+            idx += 4;
+            
+            // Account for the 9 bytes already inside the buffer.
+            if (nLen > (RxBufSize - 9) / 2) {
+                validCmd = 0;
+            } else {
+                Transport_getData(&RxBuf[idx], nLen * 2);
+                idx += nLen * 2;
+            }
+
+            break;
+
         case OPEN_EEPROM_CMD_SPI_TRANSMIT:
             Transport_getData(&RxBuf[idx], 4);
             memcpy(&nLen, &RxBuf[idx], sizeof(nLen));
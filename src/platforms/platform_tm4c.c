@@ -11,19 +11,228 @@
 #include <stddef.h>
 #include <stdbool.h>
 #include "platforms/tm4c/driverlib/hw_memmap.h"
+#include "platforms/tm4c/driverlib/hw_types.h"
+#include "platforms/tm4c/driverlib/hw_gpio.h"
+#include "platforms/tm4c/driverlib/hw_nvic.h"
+#include "platforms/tm4c/driverlib/hw_timer.h"
 #include "platforms/tm4c/driverlib/sysctl.h"
 #include "platforms/tm4c/driverlib/gpio.h"
 #include "platforms/tm4c/driverlib/ssi.h"
+#include "platforms/tm4c/driverlib/timer.h"
+#include "platforms/tm4c/driverlib/udma.h"
 #include "platforms/tm4c/driverlib/uart.h"
+#include "platforms/tm4c/tm4c_conf.h"
 #include "programmer.h"
 #include "transport.h"
 
 #define PART_TM4C123GH6PM
 #include "platforms/tm4c/driverlib/pin_map.h"
 
+#if defined(TM4C_ADDRESS_COUNTER) && \
+        (defined(OPEN_EEPROM_PARALLEL_KERNELS) || defined(OPEN_EEPROM_PARALLEL_CAPTURE))
+#error "TM4C_ADDRESS_COUNTER cannot be used with the parallel kernels or capture engine"
+#endif
+
+#if defined(TM4C_ADDRESS_COUNTER) && defined(TM4C_ADDRESS_SHIFT)
+#error "TM4C_ADDRESS_COUNTER and TM4C_ADDRESS_SHIFT cannot be used together"
+#endif
+
+#if defined(TM4C_DATA_WORD) && !defined(TM4C_ADDRESS_SHIFT)
+#error "TM4C_DATA_WORD needs TM4C_ADDRESS_SHIFT for the address bits it displaces"
+#endif
+
 #define MAX_DATA_WIDTH 8
 #define MAX_ADDRESS_WIDTH 15
 
+/* Address lines driven straight from GPIO pins. */
+#if defined(TM4C_DATA_WORD)
+#define TM4C_DIRECT_ADDRESS_WIDTH 8
+#elif defined(TM4C_ADDRESS_SHIFT)
+#define TM4C_DIRECT_ADDRESS_WIDTH 13
+#else
+#define TM4C_DIRECT_ADDRESS_WIDTH MAX_ADDRESS_WIDTH
+#endif
+#define MAX_PORT_COUNT 6
+
+#define TM4C_BUS_NONE 0
+#define TM4C_BUS_PARALLEL 1
+#define TM4C_BUS_SPI 2
+#define TM4C_DATA_MODE_UNKNOWN 0xFF
+#define TM4C_CONTROL_CE 0x01
+#define TM4C_CONTROL_OE 0x02
+#define TM4C_CONTROL_WE 0x04
+#define TM4C_CONTROL_ALL (TM4C_CONTROL_CE | TM4C_CONTROL_OE | TM4C_CONTROL_WE)
+
+/*
+ * GPIO port bases, through whichever aperture is enabled.
+ * Once a port is moved to the AHB aperture its APB registers
+ * no longer respond, so all GPIO accesses must go through these.
+ */
+#ifdef TM4C_GPIO_AHB
+#define TM4C_PORTA_BASE GPIO_PORTA_AHB_BASE
+#define TM4C_PORTB_BASE GPIO_PORTB_AHB_BASE
+#define TM4C_PORTC_BASE GPIO_PORTC_AHB_BASE
+#define TM4C_PORTD_BASE GPIO_PORTD_AHB_BASE
+#define TM4C_PORTE_BASE GPIO_PORTE_AHB_BASE
+#define TM4C_PORTF_BASE GPIO_PORTF_AHB_BASE
+#else
+#define TM4C_PORTA_BASE GPIO_PORTA_BASE
+#define TM4C_PORTB_BASE GPIO_PORTB_BASE
+#define TM4C_PORTC_BASE GPIO_PORTC_BASE
+#define TM4C_PORTD_BASE GPIO_PORTD_BASE
+#define TM4C_PORTE_BASE GPIO_PORTE_BASE
+#define TM4C_PORTF_BASE GPIO_PORTF_BASE
+#endif
+
+/*
+ * Default pad drive for each group of output pins. The high-speed mode
+ * drives the buses harder and adds slew rate control to the strobes,
+ * which the memory samples on their edges. Individual pins can be
+ * overridden in the pin table below.
+ */
+#ifdef TM4C_GPIO_AHB
+#define TM4C_ADDRESS_DRIVE GPIO_STRENGTH_8MA
+#define TM4C_DATA_DRIVE    GPIO_STRENGTH_8MA
+#define TM4C_CONTROL_DRIVE GPIO_STRENGTH_8MA_SC
+#else
+#define TM4C_ADDRESS_DRIVE GPIO_STRENGTH_2MA
+#define TM4C_DATA_DRIVE    GPIO_STRENGTH_2MA
+#define TM4C_CONTROL_DRIVE GPIO_STRENGTH_2MA
+#endif
+
+/*
+ * Cycles taken by a single GPIO register access.
+ */
+#ifdef TM4C_GPIO_AHB
+#define TM4C_GPIO_ACCESS_CYCLES 1
+#else
+#define TM4C_GPIO_ACCESS_CYCLES 3
+#endif
+
+/*
+ * Cycles a delay spends outside of its counting loop: reading the 
+ * cycle counter, the final loop test, and the GPIO access that ends 
+ * the bus phase. These are subtracted from every converted delay.
+ */
+#define TM4C_DELAY_OVERHEAD_CYCLES (4 + TM4C_GPIO_ACCESS_CYCLES)
+
+/*
+ * Cycles the strobe timer keeps counting after a pulse has ended.
+ * The timer must be stopped within this window, before it reloads
+ * and starts another pulse.
+ */
+#define TM4C_STROBE_GUARD_CYCLES 0x1000
+
+/*
+ * Bytes captured per DMA pass, and the cycles the DMA needs to 
+ * serve every channel of one capture step.
+ */
+#define TM4C_CAPTURE_CHUNK 64
+#define TM4C_CAPTURE_SERVICE_CYCLES 96
+
+/*
+ * DWT cycle counter registers, which driverlib does not define.
+ */
+#define DWT_O_CTRL              0x00000000
+#define DWT_O_CYCCNT            0x00000004
+#define DWT_CTRL_CYCCNTENA      0x00000001
+#define NVIC_DBG_INT_TRCENA     0x01000000
+
+/*
+ * Parallel bus pin assignments. These are plain macros, rather than 
+ * only entries in `Progr`, so that the pin map is also visible at 
+ * compile time to the specialized bus kernels.
+ */
+#define TM4C_A0_PORT    TM4C_PORTB_BASE
+#define TM4C_A0_PIN     GPIO_PIN_5
+#define TM4C_A1_PORT    TM4C_PORTB_BASE
+#define TM4C_A1_PIN     GPIO_PIN_0
+#define TM4C_A2_PORT    TM4C_PORTB_BASE
+#define TM4C_A2_PIN     GPIO_PIN_1
+#define TM4C_A3_PORT    TM4C_PORTE_BASE
+#define TM4C_A3_PIN     GPIO_PIN_4
+#define TM4C_A4_PORT    TM4C_PORTE_BASE
+#define TM4C_A4_PIN     GPIO_PIN_5
+#define TM4C_A5_PORT    TM4C_PORTB_BASE
+#define TM4C_A5_PIN     GPIO_PIN_4
+#define TM4C_A6_PORT    TM4C_PORTA_BASE
+#define TM4C_A6_PIN     GPIO_PIN_5
+#define TM4C_A7_PORT    TM4C_PORTA_BASE
+#define TM4C_A7_PIN     GPIO_PIN_6
+#define TM4C_A8_PORT    TM4C_PORTA_BASE
+#define TM4C_A8_PIN     GPIO_PIN_7
+#define TM4C_A9_PORT    TM4C_PORTF_BASE
+#define TM4C_A9_PIN     GPIO_PIN_1
+#define TM4C_A10_PORT   TM4C_PORTE_BASE
+#define TM4C_A10_PIN    GPIO_PIN_3
+#define TM4C_A11_PORT   TM4C_PORTE_BASE
+#define TM4C_A11_PIN    GPIO_PIN_2
+#define TM4C_A12_PORT   TM4C_PORTE_BASE
+#define TM4C_A12_PIN    GPIO_PIN_1
+#define TM4C_A13_PORT   TM4C_PORTD_BASE
+#define TM4C_A13_PIN    GPIO_PIN_3
+#define TM4C_A14_PORT   TM4C_PORTD_BASE
+#define TM4C_A14_PIN    GPIO_PIN_2
+
+#define TM4C_IO0_PORT TM4C_PORTA_BASE
+#define TM4C_IO0_PIN  GPIO_PIN_3
+#define TM4C_IO1_PORT TM4C_PORTA_BASE
+#define TM4C_IO1_PIN  GPIO_PIN_4
+#define TM4C_IO2_PORT TM4C_PORTB_BASE
+#define TM4C_IO2_PIN  GPIO_PIN_6
+#define TM4C_IO3_PORT TM4C_PORTB_BASE
+#define TM4C_IO3_PIN  GPIO_PIN_7
+#define TM4C_IO4_PORT TM4C_PORTC_BASE
+#define TM4C_IO4_PIN  GPIO_PIN_5
+#define TM4C_IO5_PORT TM4C_PORTC_BASE
+#define TM4C_IO5_PIN  GPIO_PIN_4
+#define TM4C_IO6_PORT TM4C_PORTE_BASE
+#define TM4C_IO6_PIN  GPIO_PIN_0
+#define TM4C_IO7_PORT TM4C_PORTB_BASE
+#define TM4C_IO7_PIN  GPIO_PIN_2
+
+#define TM4C_IO8_PORT  TM4C_PORTA_BASE
+#define TM4C_IO8_PIN   GPIO_PIN_7
+#define TM4C_IO9_PORT  TM4C_PORTF_BASE
+#define TM4C_IO9_PIN   GPIO_PIN_1
+#define TM4C_IO10_PORT TM4C_PORTE_BASE
+#define TM4C_IO10_PIN  GPIO_PIN_3
+#define TM4C_IO11_PORT TM4C_PORTE_BASE
+#define TM4C_IO11_PIN  GPIO_PIN_2
+#define TM4C_IO12_PORT TM4C_PORTE_BASE
+#define TM4C_IO12_PIN  GPIO_PIN_1
+#define TM4C_IO13_PORT TM4C_PORTD_BASE
+#define TM4C_IO13_PIN  GPIO_PIN_2
+#define TM4C_IO14_PORT TM4C_PORTB_BASE
+#define TM4C_IO14_PIN  GPIO_PIN_3
+#define TM4C_IO15_PORT TM4C_PORTF_BASE
+#define TM4C_IO15_PIN  GPIO_PIN_4
+
+#ifdef TM4C_TIMED_STROBE
+#define TM4C_CE_PORT  TM4C_PORTC_BASE
+#define TM4C_CE_PIN   GPIO_PIN_6
+#else
+#define TM4C_CE_PORT  TM4C_PORTA_BASE
+#define TM4C_CE_PIN   GPIO_PIN_2
+#endif
+#define TM4C_OE_PORT  TM4C_PORTD_BASE
+#define TM4C_OE_PIN   GPIO_PIN_6
+#define TM4C_WE_PORT  TM4C_PORTC_BASE
+#define TM4C_WE_PIN   GPIO_PIN_7
+
+/* Active high enable for an external Vpp/PGM switch. */
+#define TM4C_VPP_PORT TM4C_PORTF_BASE
+#define TM4C_VPP_PIN  GPIO_PIN_2
+
+#define TM4C_COUNTER_CLK_PORT TM4C_PORTB_BASE
+#define TM4C_COUNTER_CLK_PIN  GPIO_PIN_3
+#define TM4C_COUNTER_RST_PORT TM4C_PORTF_BASE
+#define TM4C_COUNTER_RST_PIN  GPIO_PIN_3
+
+#define TM4C_SHIFT_LATCH_PORT TM4C_PORTD_BASE
+#define TM4C_SHIFT_LATCH_PIN  GPIO_PIN_1
+#define TM4C_SHIFT_FREQ       20000000
+
 /**
  * @struct
  * Representation of a GPIO pin on the TM4C MCU.
@@ -31,9 +240,70 @@
 typedef struct {
     uint32_t port;
     uint8_t pin;
+    uint32_t drive;
 } DriverLibGpioPin;
 
 
+/**
+ * @struct
+ * Lines of a bus that share a single GPIO port.
+ *
+ * `bit[i]` is the bus bit that drives the pin at position `shift[i]`,
+ * so the port's value for a bus word can be assembled in a register
+ * and written with one masked store to the DATA register.
+ */
+typedef struct {
+    uint32_t port;
+    uint32_t bits;
+    uint8_t mask;
+    uint8_t count;
+    uint8_t bit[8];
+    uint8_t shift[8];
+} DriverLibPortGroup;
+
+/**
+ * @struct
+ * A bus pin table compiled into per-port groups.
+ *
+ * `value` is the last word written to the bus, which allows 
+ * sequential updates to skip lines that do not change.
+ */
+typedef struct {
+    uint8_t width;
+    uint8_t count;
+    uint32_t value;
+    DriverLibPortGroup group[MAX_PORT_COUNT];
+} DriverLibBusMap;
+
+/**
+ * @struct
+ * What the IO lines are currently set up for.
+ *
+ * Pins are only reconfigured when the bus or the data direction
+ * actually changes, and are put back in a known state when PA2-PA5
+ * pass between the parallel bus and SSI0. Control lines are only 
+ * written when their level changes; `controlKnown` has a bit set for 
+ * each of CE, OE and WE whose level in `controlHigh` is up to date.
+ */
+typedef struct {
+    uint8_t bus;
+    uint8_t dataMode;
+    uint8_t controlKnown;
+    uint8_t controlHigh;
+} DriverLibBusSession;
+
+/**
+ * @struct
+ * A timer half and the uDMA channel its timeout requests.
+ */
+typedef struct {
+    uint32_t periph;
+    uint32_t base;
+    uint32_t timer;
+    uint32_t sync;
+    uint32_t mapping;
+} DriverLibDmaTimer;
+
 /**
  * @struct 
  * Representation of a SPI peripheral on the TM4C MCU.
@@ -56,9 +326,14 @@ typedef struct {
     uint32_t ports[10];
     DriverLibGpioPin A[MAX_ADDRESS_WIDTH];
     DriverLibGpioPin IO[MAX_DATA_WIDTH];
+    DriverLibGpioPin IOH[MAX_DATA_WIDTH];
     DriverLibGpioPin WEn;
     DriverLibGpioPin OEn;
     DriverLibGpioPin CEn;
+    DriverLibGpioPin Vpp;
+    DriverLibGpioPin CounterClk;
+    DriverLibGpioPin CounterRst;
+    DriverLibGpioPin ShiftLatch;
     DriverLibSpiModule spi;
 } DriverLibProgrammer;
 
@@ -72,97 +347,257 @@ static DriverLibProgrammer Progr = {
         SYSCTL_PERIPH_GPIOF
     },
     .A = {
-        {GPIO_PORTB_BASE, GPIO_PIN_5},
-        {GPIO_PORTB_BASE, GPIO_PIN_0},
-        {GPIO_PORTB_BASE, GPIO_PIN_1},
-        {GPIO_PORTE_BASE, GPIO_PIN_4},
-        {GPIO_PORTE_BASE, GPIO_PIN_5},
-        {GPIO_PORTB_BASE, GPIO_PIN_4},
-        {GPIO_PORTA_BASE, GPIO_PIN_5},
-        {GPIO_PORTA_BASE, GPIO_PIN_6},
-        {GPIO_PORTA_BASE, GPIO_PIN_7},
-        {GPIO_PORTF_BASE, GPIO_PIN_1},
-        {GPIO_PORTE_BASE, GPIO_PIN_3},
-        {GPIO_PORTE_BASE, GPIO_PIN_2},
-        {GPIO_PORTE_BASE, GPIO_PIN_1},
-        {GPIO_PORTD_BASE, GPIO_PIN_3},
-        {GPIO_PORTD_BASE, GPIO_PIN_2},
+        {TM4C_A0_PORT, TM4C_A0_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A1_PORT, TM4C_A1_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A2_PORT, TM4C_A2_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A3_PORT, TM4C_A3_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A4_PORT, TM4C_A4_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A5_PORT, TM4C_A5_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A6_PORT, TM4C_A6_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A7_PORT, TM4C_A7_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A8_PORT, TM4C_A8_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A9_PORT, TM4C_A9_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A10_PORT, TM4C_A10_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A11_PORT, TM4C_A11_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A12_PORT, TM4C_A12_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A13_PORT, TM4C_A13_PIN, TM4C_ADDRESS_DRIVE},
+        {TM4C_A14_PORT, TM4C_A14_PIN, TM4C_ADDRESS_DRIVE},
     },
     .IO = {
-        {GPIO_PORTA_BASE, GPIO_PIN_3},
-        {GPIO_PORTA_BASE, GPIO_PIN_4},
-        {GPIO_PORTB_BASE, GPIO_PIN_6},
-        {GPIO_PORTB_BASE, GPIO_PIN_7},
-        {GPIO_PORTC_BASE, GPIO_PIN_5},
-        {GPIO_PORTC_BASE, GPIO_PIN_4},
-        {GPIO_PORTE_BASE, GPIO_PIN_0},
-        {GPIO_PORTB_BASE, GPIO_PIN_2},
-
+        {TM4C_IO0_PORT, TM4C_IO0_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO1_PORT, TM4C_IO1_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO2_PORT, TM4C_IO2_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO3_PORT, TM4C_IO3_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO4_PORT, TM4C_IO4_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO5_PORT, TM4C_IO5_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO6_PORT, TM4C_IO6_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO7_PORT, TM4C_IO7_PIN, TM4C_DATA_DRIVE},
     },
-    .CEn = {GPIO_PORTA_BASE, GPIO_PIN_2},
-    .OEn = {GPIO_PORTD_BASE, GPIO_PIN_6},
-    .WEn = {GPIO_PORTC_BASE, GPIO_PIN_7},
+    .IOH = {
+        {TM4C_IO8_PORT, TM4C_IO8_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO9_PORT, TM4C_IO9_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO10_PORT, TM4C_IO10_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO11_PORT, TM4C_IO11_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO12_PORT, TM4C_IO12_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO13_PORT, TM4C_IO13_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO14_PORT, TM4C_IO14_PIN, TM4C_DATA_DRIVE},
+        {TM4C_IO15_PORT, TM4C_IO15_PIN, TM4C_DATA_DRIVE},
+    },
+    .CEn = {TM4C_CE_PORT, TM4C_CE_PIN, TM4C_CONTROL_DRIVE},
+    .OEn = {TM4C_OE_PORT, TM4C_OE_PIN, TM4C_CONTROL_DRIVE},
+    .WEn = {TM4C_WE_PORT, TM4C_WE_PIN, TM4C_CONTROL_DRIVE},
+    .Vpp = {TM4C_VPP_PORT, TM4C_VPP_PIN, TM4C_CONTROL_DRIVE},
+    .CounterClk = {TM4C_COUNTER_CLK_PORT, TM4C_COUNTER_CLK_PIN, TM4C_CONTROL_DRIVE},
+    .CounterRst = {TM4C_COUNTER_RST_PORT, TM4C_COUNTER_RST_PIN, TM4C_CONTROL_DRIVE},
+    .ShiftLatch = {TM4C_SHIFT_LATCH_PORT, TM4C_SHIFT_LATCH_PIN, TM4C_CONTROL_DRIVE},
     .spi = {
-        .CLK = {GPIO_PORTA_BASE, GPIO_PIN_2},
-        .CS = {GPIO_PORTA_BASE, GPIO_PIN_3},
-        .RX = {GPIO_PORTA_BASE, GPIO_PIN_4},
-        .TX = {GPIO_PORTA_BASE, GPIO_PIN_5}
+        .CLK = {TM4C_PORTA_BASE, GPIO_PIN_2},
+        .CS = {TM4C_PORTA_BASE, GPIO_PIN_3, TM4C_CONTROL_DRIVE},
+        .RX = {TM4C_PORTA_BASE, GPIO_PIN_4},
+        .TX = {TM4C_PORTA_BASE, GPIO_PIN_5}
     }
 };
 
 static DriverLibProgrammer *ProgrPtr = &Progr;
+#ifndef TM4C_ADDRESS_COUNTER
+static DriverLibBusMap AddressBus;
+#endif
+static DriverLibBusMap DataBus;
+static DriverLibBusSession Session = {TM4C_BUS_NONE, TM4C_DATA_MODE_UNKNOWN, 0, 0};
+
+/* 
+ * Per-port values that output each data byte, and per-port
+ * lookups that turn a masked DATA register read back into data bits.
+ */
+static uint8_t DataScatter[1 << MAX_DATA_WIDTH][MAX_PORT_COUNT];
+static uint8_t DataGather[MAX_PORT_COUNT][1 << MAX_DATA_WIDTH];
+#ifdef TM4C_DATA_WORD
+/* The same for the D15:D8 pin group of a 16-bit bus. */
+static DriverLibBusMap DataBusHigh;
+static uint8_t DataScatterHigh[1 << MAX_DATA_WIDTH][MAX_PORT_COUNT];
+static uint8_t DataGatherHigh[MAX_PORT_COUNT][1 << MAX_DATA_WIDTH];
+#endif
 static uint32_t CurrentSpiMode;
 static uint32_t CurrentSpiFreq;
+static uint32_t CyclesPerMicrosecond;
+#ifdef TM4C_TIMED_STROBE
+static bool StrobeTimerAttached;
+#endif
+#ifdef TM4C_ADDRESS_COUNTER
+static uint32_t CounterValue;
+#endif
+#ifdef TM4C_ADDRESS_SHIFT
+/* Upper address bits held by the shift registers, all ones if unknown. */
+static uint32_t ShiftValue;
+#endif
+
+static void compileBusMap(DriverLibBusMap *map, const DriverLibGpioPin *pins, uint8_t width);
+static inline uint8_t busPortValue(const DriverLibPortGroup *group, uint32_t value);
+static inline void writeBusMap(DriverLibBusMap *map, uint32_t value);
+static inline void updateBusMap(DriverLibBusMap *map, uint32_t value);
+static void compileDataTables(DriverLibBusMap *map, const DriverLibGpioPin *pins,
+        uint8_t (*scatter)[MAX_PORT_COUNT], uint8_t (*gather)[1 << MAX_DATA_WIDTH]);
+static void configureOutputPin(const DriverLibGpioPin *pin);
+static inline void delayCycles(uint32_t cycles);
+static inline void writeControlLine(const DriverLibGpioPin *pin, uint8_t line, uint8_t state);
+#ifdef TM4C_TIMED_STROBE
+static void attachStrobeTimer(void);
+static void detachStrobeTimer(void);
+#endif
+#ifdef TM4C_ADDRESS_COUNTER
+static void resetAddressCounter(void);
+static inline void clockAddressCounter(uint32_t pulses);
+#endif
+static inline uint8_t directAddressWidth(uint8_t busWidth);
+#ifdef TM4C_ADDRESS_SHIFT
+static inline void shiftAddress(uint8_t busWidth, uint32_t address);
+#endif
 
 /* 
  * The TM4C has a max clock speed of 80 MHz,
- * or 12.5 ns per instruction.
+ * or 12.5 ns per instruction. No bus phase can be 
+ * shorter than the GPIO access that ends it.
  */
-const uint32_t Programmer_MinimumDelay = 13;
+const uint32_t Programmer_MinimumDelay = (TM4C_GPIO_ACCESS_CYCLES * 125 + 9) / 10;
 
 int Programmer_init(void) {
     SysCtlClockSet(SYSCTL_SYSDIV_2_5 | SYSCTL_USE_PLL | SYSCTL_XTAL_16MHZ | SYSCTL_OSC_MAIN);
+    CyclesPerMicrosecond = SysCtlClockGet() / 1000000;
+
+    /* Start the DWT cycle counter used by the delay functions. */
+    HWREG(NVIC_DBG_INT) |= NVIC_DBG_INT_TRCENA;
+    HWREG(DWT_BASE + DWT_O_CYCCNT) = 0;
+    HWREG(DWT_BASE + DWT_O_CTRL) |= DWT_CTRL_CYCCNTENA;
 
     for (uint32_t *port = ProgrPtr->ports; *port != 0; port++) {
         SysCtlPeripheralEnable(*port);
         while (!SysCtlPeripheralReady(*port))
             ;
+#ifdef TM4C_GPIO_AHB
+        SysCtlGPIOAHBEnable(*port);
+#endif
     }
+    Session.bus = TM4C_BUS_NONE;
+    Session.dataMode = TM4C_DATA_MODE_UNKNOWN;
+    Session.controlKnown = 0;
     return 1;
 }
 
 int Programmer_initParallel(void) {
-    GPIOPinTypeGPIOOutput(ProgrPtr->WEn.port, ProgrPtr->WEn.pin);
-    GPIOPinTypeGPIOOutput(ProgrPtr->CEn.port, ProgrPtr->CEn.pin);
-    GPIOPinTypeGPIOOutput(ProgrPtr->OEn.port, ProgrPtr->OEn.pin);
+    if (Session.bus == TM4C_BUS_PARALLEL) {
+        return 1;
+    }
+
+    /* CE, IO0, IO1 and A6 share PA2-PA5 with SSI0. Configuring
+       them as GPIO outputs below takes them back from the SSI. */
+    if (Session.bus == TM4C_BUS_SPI) {
+        SSIDisable(SSI0_BASE);
+    }
+
+    configureOutputPin(&ProgrPtr->WEn);
+    configureOutputPin(&ProgrPtr->CEn);
+    configureOutputPin(&ProgrPtr->OEn);
+    configureOutputPin(&ProgrPtr->Vpp);
+
+#ifdef TM4C_TIMED_STROBE
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_WTIMER1);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_WTIMER1))
+        ;
+    TimerConfigure(WTIMER1_BASE, TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_PWM);
+    /* Inverted, the output is low from the reload until the match. */
+    TimerControlLevel(WTIMER1_BASE, TIMER_A, true);
+    StrobeTimerAttached = false;
+#endif
 
     GPIOPinWrite(ProgrPtr->WEn.port, ProgrPtr->WEn.pin, ProgrPtr->WEn.pin);
     GPIOPinWrite(ProgrPtr->CEn.port, ProgrPtr->CEn.pin, ProgrPtr->CEn.pin);
     GPIOPinWrite(ProgrPtr->OEn.port, ProgrPtr->OEn.pin, ProgrPtr->OEn.pin);
+    GPIOPinWrite(ProgrPtr->Vpp.port, ProgrPtr->Vpp.pin, 0);
+    Session.controlKnown = TM4C_CONTROL_ALL;
+    Session.controlHigh = TM4C_CONTROL_ALL;
 
-    for (int i = 0; i < MAX_ADDRESS_WIDTH; i++ ) {
-        GPIOPinTypeGPIOOutput(ProgrPtr->A[i].port, ProgrPtr->A[i].pin);
+#ifdef TM4C_ADDRESS_COUNTER
+    configureOutputPin(&ProgrPtr->CounterClk);
+    configureOutputPin(&ProgrPtr->CounterRst);
+    GPIOPinWrite(ProgrPtr->CounterClk.port, ProgrPtr->CounterClk.pin, 0);
+    resetAddressCounter();
+#else
+    for (int i = 0; i < TM4C_DIRECT_ADDRESS_WIDTH; i++ ) {
+        configureOutputPin(&ProgrPtr->A[i]);
     }    
 
+    compileBusMap(&AddressBus, ProgrPtr->A, TM4C_DIRECT_ADDRESS_WIDTH);
+#endif
+
+#ifdef TM4C_ADDRESS_SHIFT
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_SSI1);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_SSI1))
+        ;
+    GPIOPinConfigure(GPIO_PD0_SSI1CLK);
+    GPIOPinConfigure(GPIO_PD3_SSI1TX);
+    GPIOPinTypeSSI(TM4C_PORTD_BASE, GPIO_PIN_0 | GPIO_PIN_3);
+    SSIConfigSetExpClk(SSI1_BASE, SysCtlClockGet(), SSI_FRF_MOTO_MODE_0, 
+            SSI_MODE_MASTER, TM4C_SHIFT_FREQ, TM4C_ADDRESS_SHIFT_BITS);
+    SSIEnable(SSI1_BASE);
+
+    configureOutputPin(&ProgrPtr->ShiftLatch);
+    GPIOPinWrite(ProgrPtr->ShiftLatch.port, ProgrPtr->ShiftLatch.pin, 0);
+    ShiftValue = UINT32_MAX;
+#endif
+    compileDataTables(&DataBus, ProgrPtr->IO, DataScatter, DataGather);
+#ifdef TM4C_DATA_WORD
+    compileDataTables(&DataBusHigh, ProgrPtr->IOH, DataScatterHigh, DataGatherHigh);
+#endif
+
+    /* Pad drive is set once here, direction changes only touch GPIODIR. 
+       The data bus starts out as inputs so nothing is driven onto it. */
+    for (int i = 0; i < MAX_DATA_WIDTH; i++) {
+        GPIOPadConfigSet(ProgrPtr->IO[i].port, ProgrPtr->IO[i].pin, 
+                ProgrPtr->IO[i].drive, GPIO_PIN_TYPE_STD);
+#ifdef TM4C_DATA_WORD
+        GPIOPadConfigSet(ProgrPtr->IOH[i].port, ProgrPtr->IOH[i].pin, 
+                ProgrPtr->IOH[i].drive, GPIO_PIN_TYPE_STD);
+#endif
+    }
+    Session.dataMode = TM4C_DATA_MODE_UNKNOWN;
+    Programmer_toggleDataIOMode(0);
+
+    Session.bus = TM4C_BUS_PARALLEL;
+
     return 1;
 }
 
 int Programmer_initSpi(void) {
+    if (Session.bus == TM4C_BUS_SPI) {
+        return 1;
+    }
+
+    /* Leave a parallel chip deselected before CE, IO0, IO1 and A6 
+       are handed to SSI0. */
+    if (Session.bus == TM4C_BUS_PARALLEL) {
+#ifdef TM4C_TIMED_STROBE
+        detachStrobeTimer();
+#endif
+        GPIOPinWrite(ProgrPtr->WEn.port, ProgrPtr->WEn.pin, ProgrPtr->WEn.pin);
+        GPIOPinWrite(ProgrPtr->OEn.port, ProgrPtr->OEn.pin, ProgrPtr->OEn.pin);
+        GPIOPinWrite(ProgrPtr->CEn.port, ProgrPtr->CEn.pin, ProgrPtr->CEn.pin);
+        GPIOPinWrite(ProgrPtr->Vpp.port, ProgrPtr->Vpp.pin, 0);
+    }
+    Session.dataMode = TM4C_DATA_MODE_UNKNOWN;
+    Session.controlKnown = 0;
+
     SysCtlPeripheralEnable(SYSCTL_PERIPH_SSI0);
-    SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
-    SysCtlPeripheralEnable(ProgrPtr->spi.CLK.port);
-    SysCtlPeripheralEnable(ProgrPtr->spi.CS.port);
-    SysCtlPeripheralEnable(ProgrPtr->spi.RX.port);
-    SysCtlPeripheralEnable(ProgrPtr->spi.TX.port);
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_SSI0))
+        ;
 
     GPIOPinConfigure(GPIO_PA2_SSI0CLK);
     GPIOPinConfigure(GPIO_PA4_SSI0RX);
     GPIOPinConfigure(GPIO_PA5_SSI0TX);
 
-    GPIOPinTypeSSI(GPIO_PORTA_BASE, 
+    GPIOPinTypeSSI(TM4C_PORTA_BASE, 
                      GPIO_PIN_5 | GPIO_PIN_4 | GPIO_PIN_2);
 
-    GPIOPinTypeGPIOOutput(ProgrPtr->spi.CS.port, ProgrPtr->spi.CS.pin);
+    configureOutputPin(&ProgrPtr->spi.CS);
 
     /* Default to 1MHz, don't need to set CurrentSpiMode
        because its 0 by default. */
@@ -177,89 +612,237 @@ int Programmer_initSpi(void) {
 
     SSIEnable(SSI0_BASE);
 
+    Session.bus = TM4C_BUS_SPI;
+
     return 1;
 }
 
 // TODO: confirm that this disables peripheral
 int Programmer_disableIOPins(void) {
+    if (Session.bus == TM4C_BUS_PARALLEL) {
+        GPIOPinWrite(ProgrPtr->Vpp.port, ProgrPtr->Vpp.pin, 0);
+    }
     for (uint32_t *port = ProgrPtr->ports; *port != 0; port++) {
         SysCtlPeripheralDisable(*port);
     }
+    Session.bus = TM4C_BUS_NONE;
+    Session.dataMode = TM4C_DATA_MODE_UNKNOWN;
+    Session.controlKnown = 0;
     return 1;
 }
 
 int Programmer_toggleDataIOMode(uint8_t mode) {
-    if (mode == 0) {
-        for (int i = 0; i < MAX_DATA_WIDTH; i++) {
-            GPIOPinTypeGPIOInput(ProgrPtr->IO[i].port, ProgrPtr->IO[i].pin);
-        }
-    } else {
-        for (int i = 0; i < MAX_DATA_WIDTH; i++) {
-            GPIOPinTypeGPIOOutput(ProgrPtr->IO[i].port, ProgrPtr->IO[i].pin);
-        }
+    uint32_t dir = mode == 0 ? GPIO_DIR_MODE_IN : GPIO_DIR_MODE_OUT;
+
+    mode = mode != 0;
+    if (Session.dataMode == mode) {
+        return 1;
     }
+    for (uint8_t i = 0; i < DataBus.count; i++) {
+        GPIODirModeSet(DataBus.group[i].port, DataBus.group[i].mask, dir);
+    }
+#ifdef TM4C_DATA_WORD
+    for (uint8_t i = 0; i < DataBusHigh.count; i++) {
+        GPIODirModeSet(DataBusHigh.group[i].port, DataBusHigh.group[i].mask, dir);
+    }
+#endif
+    Session.dataMode = mode;
     return 1;
 }
 
 int Programmer_getAddressPinCount(void) {
+#if defined(TM4C_ADDRESS_COUNTER)
+    return TM4C_ADDRESS_COUNTER_WIDTH;
+#elif defined(TM4C_ADDRESS_SHIFT)
+    return TM4C_DIRECT_ADDRESS_WIDTH + TM4C_ADDRESS_SHIFT_BITS;
+#else
     return sizeof(ProgrPtr->A) / sizeof(ProgrPtr->A[0]);
+#endif
 }
 
 int Programmer_setAddress(uint8_t busWidth, uint32_t address) {
-    for (int i = 0; i < busWidth; i++) {
-        GPIOPinWrite(ProgrPtr->A[i].port, ProgrPtr->A[i].pin, address & 1 ? ProgrPtr->A[i].pin : 0);
-        address >>= 1;
+#ifdef TM4C_ADDRESS_COUNTER
+    /* Only the counter's width matters, unused high outputs are not connected. */
+    (void) busWidth;
+    address &= (1UL << TM4C_ADDRESS_COUNTER_WIDTH) - 1;
+    if (address < CounterValue) {
+        resetAddressCounter();
+    }
+    clockAddressCounter(address - CounterValue);
+    CounterValue = address;
+#else
+    /* The map only needs rebuilding when the host changes the bus width. */
+    if (directAddressWidth(busWidth) != AddressBus.width) {
+        compileBusMap(&AddressBus, ProgrPtr->A, directAddressWidth(busWidth));
     }
+    writeBusMap(&AddressBus, address);
+#ifdef TM4C_ADDRESS_SHIFT
+    shiftAddress(busWidth, address);
+#endif
+#endif
     return 1;
 }
 
+int Programmer_advanceAddress(uint8_t busWidth, uint32_t address) {
+#ifdef TM4C_ADDRESS_COUNTER
+    return Programmer_setAddress(busWidth, address);
+#else
+    if (directAddressWidth(busWidth) != AddressBus.width) {
+        return Programmer_setAddress(busWidth, address);
+    }
+    updateBusMap(&AddressBus, address);
+#ifdef TM4C_ADDRESS_SHIFT
+    shiftAddress(busWidth, address);
+#endif
+    return 1;
+#endif
+}
+
 int Programmer_setData(uint8_t value) {
-    for (int i = 0; i < MAX_DATA_WIDTH; i++) {
-        GPIOPinWrite(ProgrPtr->IO[i].port, ProgrPtr->IO[i].pin, (value & 1) ? ProgrPtr->IO[i].pin : 0);
-        value >>= 1;
+    const uint8_t *scatter = DataScatter[value];
+    for (uint8_t i = 0; i < DataBus.count; i++) {
+        HWREG(DataBus.group[i].port + GPIO_O_DATA + (DataBus.group[i].mask << 2)) = scatter[i];
     }
     return 1;
 }
 
+int Programmer_setDataWord(uint16_t value) {
+    Programmer_setData(value & 0xFF);
+#ifdef TM4C_DATA_WORD
+    const uint8_t *scatter = DataScatterHigh[value >> 8];
+    for (uint8_t i = 0; i < DataBusHigh.count; i++) {
+        HWREG(DataBusHigh.group[i].port + GPIO_O_DATA + (DataBusHigh.group[i].mask << 2)) = scatter[i];
+    }
+#endif
+    return 1;
+}
+
 int Programmer_toggleCE(uint8_t state) {
-    GPIOPinWrite(ProgrPtr->CEn.port, ProgrPtr->CEn.pin, state == 0 ? 0 : ProgrPtr->CEn.pin); 
+#ifdef TM4C_TIMED_STROBE
+    detachStrobeTimer();
+#endif
+    writeControlLine(&ProgrPtr->CEn, TM4C_CONTROL_CE, state);
+    return 1;
+}
+
+int Programmer_startCEPulse(uint32_t ticks) {
+#ifdef TM4C_TIMED_STROBE
+    /* The timer produces the whole width by itself, so give back 
+       the software overhead taken out by the conversion. */
+    uint32_t load = ticks + TM4C_DELAY_OVERHEAD_CYCLES + TM4C_STROBE_GUARD_CYCLES;
+
+    /* The timer owns CE now, the next toggleCE must write it. */
+    Session.controlKnown &= ~TM4C_CONTROL_CE;
+    attachStrobeTimer();
+    TimerLoadSet(WTIMER1_BASE, TIMER_A, load);
+    TimerMatchSet(WTIMER1_BASE, TIMER_A, TM4C_STROBE_GUARD_CYCLES);
+    HWREG(WTIMER1_BASE + TIMER_O_TAV) = load;
+    TimerEnable(WTIMER1_BASE, TIMER_A);
+#else
+    HWREG(ProgrPtr->CEn.port + GPIO_O_DATA + (ProgrPtr->CEn.pin << 2)) = 0;
+    delayCycles(ticks);
+    HWREG(ProgrPtr->CEn.port + GPIO_O_DATA + (ProgrPtr->CEn.pin << 2)) = ProgrPtr->CEn.pin;
+    Session.controlKnown |= TM4C_CONTROL_CE;
+    Session.controlHigh |= TM4C_CONTROL_CE;
+#endif
+    return 1;
+}
+
+int Programmer_waitCEPulse(void) {
+#ifdef TM4C_TIMED_STROBE
+    while (HWREG(WTIMER1_BASE + TIMER_O_TAV) > TM4C_STROBE_GUARD_CYCLES)
+        ;
+    TimerDisable(WTIMER1_BASE, TIMER_A);
+#endif
     return 1;
 }
 
 int Programmer_toggleOE(uint8_t state) {
-    GPIOPinWrite(ProgrPtr->OEn.port, ProgrPtr->OEn.pin, state == 0 ? 0 : ProgrPtr->OEn.pin); 
+    writeControlLine(&ProgrPtr->OEn, TM4C_CONTROL_OE, state);
     return 1;
 }
 
 int Programmer_toggleWE(uint8_t state) {
-    GPIOPinWrite(ProgrPtr->WEn.port, ProgrPtr->WEn.pin, state == 0 ? 0 : ProgrPtr->WEn.pin); 
+    writeControlLine(&ProgrPtr->WEn, TM4C_CONTROL_WE, state);
+    return 1;
+}
+
+int Programmer_toggleVpp(uint8_t state) {
+    GPIOPinWrite(ProgrPtr->Vpp.port, ProgrPtr->Vpp.pin, state == 0 ? 0 : ProgrPtr->Vpp.pin); 
     return 1;
 }
 
 uint8_t Programmer_getData(void) {
     uint8_t data = 0;
-    for (int i = 0; i < MAX_DATA_WIDTH; i++) {
-        data |= (GPIOPinRead(ProgrPtr->IO[i].port, ProgrPtr->IO[i].pin) ? 1 : 0) << i;
+    for (uint8_t i = 0; i < DataBus.count; i++) {
+        data |= DataGather[i][HWREG(DataBus.group[i].port + GPIO_O_DATA + (DataBus.group[i].mask << 2))];
+    }
+    return data;
+}
+
+uint16_t Programmer_getDataWord(void) {
+    uint16_t data = Programmer_getData();
+#ifdef TM4C_DATA_WORD
+    uint8_t high = 0;
+    for (uint8_t i = 0; i < DataBusHigh.count; i++) {
+        high |= DataGatherHigh[i][HWREG(DataBusHigh.group[i].port + GPIO_O_DATA + (DataBusHigh.group[i].mask << 2))];
     }
+    data |= (uint16_t) high << 8;
+#endif
     return data;
 }
 
+int Programmer_getDataPinCount(void) {
+#ifdef TM4C_DATA_WORD
+    return 2 * MAX_DATA_WIDTH;
+#else
+    return MAX_DATA_WIDTH;
+#endif
+}
+
 int Programmer_delay1ns(uint32_t delay) {
-    /* Assume system clock running at 80MHz -> 12.5ns per cycle
-       This means the delay can only be in 12.5ns increments.
-       However, as delay increases the percent error decreases.
-       Generally it should be okay if the delay is a bit longer
-       than requested; shorter could be a problem. 
-       So we round up just to be safe. */
-    if (delay < Programmer_MinimumDelay || delay > (UINT32_MAX / 10)) {
+    if (delay < Programmer_MinimumDelay) {
         return 0;
     } else {
-        delay = ((delay * 10) + (124)) / 125;  // fixed-point to make 12.5 a whole number
-        SysCtlDelay(delay);
+        delayCycles(Programmer_nsToDelayTicks(delay));
         return 1;
     }
 }
 
+/* 
+ * Delay ticks are system clock cycles counted by the DWT. 
+ * Generally it should be okay if the delay is a bit longer
+ * than requested; shorter could be a problem. 
+ * So we round up just to be safe. 
+ */
+uint32_t Programmer_nsToDelayTicks(uint32_t delay) {
+    /* Split the conversion so that it cannot overflow 32 bits. */
+    uint32_t cycles = (delay / 1000) * CyclesPerMicrosecond + 
+        ((delay % 1000) * CyclesPerMicrosecond + 999) / 1000;
+
+    return cycles > TM4C_DELAY_OVERHEAD_CYCLES ? cycles - TM4C_DELAY_OVERHEAD_CYCLES : 0;
+}
+
+int Programmer_delayTicks(uint32_t ticks) {
+    delayCycles(ticks);
+    return 1;
+}
+
+uint32_t Programmer_measureDelay(uint32_t delay) {
+    uint32_t ticks = Programmer_nsToDelayTicks(delay);
+    uint32_t start, cycles;
+
+    /* Time the delay together with a GPIO access standing in 
+       for the bus update that would end it. */
+    start = HWREG(DWT_BASE + DWT_O_CYCCNT);
+    delayCycles(ticks);
+    HWREG(ProgrPtr->CEn.port + GPIO_O_DATA);
+    cycles = HWREG(DWT_BASE + DWT_O_CYCCNT) - start;
+
+    return (cycles / CyclesPerMicrosecond) * 1000 + 
+        ((cycles % CyclesPerMicrosecond) * 1000) / CyclesPerMicrosecond;
+}
+
 int Programmer_enableChip(void) {
     return 1;
 }
@@ -298,13 +881,651 @@ int Programmer_spiTransmit(const char *txbuf, char *rxbuf, size_t count) {
     return 1;
 }
 
+/*
+ * Spin until `cycles` system clock cycles have passed.
+ * Unsigned subtraction keeps this correct across counter wrap.
+ */
+static inline void delayCycles(uint32_t cycles) {
+    uint32_t start = HWREG(DWT_BASE + DWT_O_CYCCNT);
+    while ((HWREG(DWT_BASE + DWT_O_CYCCNT) - start) < cycles)
+        ;
+}
+
+/*
+ * Hand the CE pin to the strobe timer, or take it back as a GPIO.
+ * This only happens when switching between strobed writes and 
+ * direct CE control, not on every pulse.
+ */
+#ifdef TM4C_TIMED_STROBE
+static void attachStrobeTimer(void) {
+    if (!StrobeTimerAttached) {
+        GPIOPinConfigure(GPIO_PC6_WT1CCP0);
+        GPIOPinTypeTimer(ProgrPtr->CEn.port, ProgrPtr->CEn.pin);
+        StrobeTimerAttached = true;
+    }
+}
+
+static void detachStrobeTimer(void) {
+    if (StrobeTimerAttached) {
+        configureOutputPin(&ProgrPtr->CEn);
+        StrobeTimerAttached = false;
+    }
+}
+#endif
+
+#ifdef TM4C_ADDRESS_COUNTER
+static void resetAddressCounter(void) {
+    const DriverLibGpioPin *rst = &ProgrPtr->CounterRst;
+    HWREG(rst->port + GPIO_O_DATA + (rst->pin << 2)) = rst->pin;
+    HWREG(rst->port + GPIO_O_DATA + (rst->pin << 2)) = 0;
+    CounterValue = 0;
+}
+
+/*
+ * The counter advances on the falling edge. On AHB the high phase
+ * is written twice so it meets the counter's minimum pulse width.
+ */
+static inline void clockAddressCounter(uint32_t pulses) {
+    const uint32_t reg = ProgrPtr->CounterClk.port + GPIO_O_DATA + (ProgrPtr->CounterClk.pin << 2);
+    const uint8_t pin = ProgrPtr->CounterClk.pin;
+
+    for (; pulses > 0; pulses--) {
+        HWREG(reg) = pin;
+#ifdef TM4C_GPIO_AHB
+        HWREG(reg) = pin;
+#endif
+        HWREG(reg) = 0;
+    }
+}
+#endif
+
+static inline uint8_t directAddressWidth(uint8_t busWidth) {
+    return busWidth < TM4C_DIRECT_ADDRESS_WIDTH ? busWidth : TM4C_DIRECT_ADDRESS_WIDTH;
+}
+
+#ifdef TM4C_ADDRESS_SHIFT
+/*
+ * Load the address bits above the direct lines into the shift 
+ * registers and latch them, unless they already hold them.
+ */
+static inline void shiftAddress(uint8_t busWidth, uint32_t address) {
+    const DriverLibGpioPin *latch = &ProgrPtr->ShiftLatch;
+    uint32_t upper = 0;
+
+    if (busWidth > TM4C_DIRECT_ADDRESS_WIDTH) {
+        upper = (address >> TM4C_DIRECT_ADDRESS_WIDTH) & 
+            ((1UL << (busWidth - TM4C_DIRECT_ADDRESS_WIDTH)) - 1);
+    }
+    if (upper == ShiftValue) {
+        return;
+    }
+
+    SSIDataPut(SSI1_BASE, upper);
+    while (SSIBusy(SSI1_BASE))
+        ;
+    HWREG(latch->port + GPIO_O_DATA + (latch->pin << 2)) = latch->pin;
+    HWREG(latch->port + GPIO_O_DATA + (latch->pin << 2)) = 0;
+    ShiftValue = upper;
+}
+#endif
+
+/*
+ * Drive a control line, skipping the GPIO write 
+ * if the line is already known to be at `state`.
+ */
+static inline void writeControlLine(const DriverLibGpioPin *pin, uint8_t line, uint8_t state) {
+    uint8_t high = state != 0 ? line : 0;
+
+    if ((Session.controlKnown & line) && (Session.controlHigh & line) == high) {
+        return;
+    }
+    HWREG(pin->port + GPIO_O_DATA + (pin->pin << 2)) = high ? pin->pin : 0;
+    Session.controlKnown |= line;
+    Session.controlHigh = (Session.controlHigh & ~line) | high;
+}
+
+/*
+ * Make `pin` a GPIO output with its configured pad drive.
+ */
+static void configureOutputPin(const DriverLibGpioPin *pin) {
+    GPIOPinTypeGPIOOutput(pin->port, pin->pin);
+    GPIOPadConfigSet(pin->port, pin->pin, pin->drive, GPIO_PIN_TYPE_STD);
+}
+
+/*
+ * Group the first `width` pins of a bus pin table by port.
+ */
+static void compileBusMap(DriverLibBusMap *map, const DriverLibGpioPin *pins, uint8_t width) {
+    map->width = width;
+    map->count = 0;
+
+    for (uint8_t i = 0; i < width; i++) {
+        DriverLibPortGroup *group = NULL;
+
+        for (uint8_t j = 0; j < map->count; j++) {
+            if (map->group[j].port == pins[i].port) {
+                group = &map->group[j];
+                break;
+            }
+        }
+
+        if (group == NULL) {
+            group = &map->group[map->count++];
+            group->port = pins[i].port;
+            group->bits = 0;
+            group->mask = 0;
+            group->count = 0;
+        }
+
+        group->bits |= 1UL << i;
+        group->mask |= pins[i].pin;
+        group->bit[group->count] = i;
+        group->shift[group->count] = __builtin_ctz(pins[i].pin);
+        group->count++;
+    }
+}
+
+/*
+ * Value of a port group's pins for the bus word `value`.
+ */
+static inline uint8_t busPortValue(const DriverLibPortGroup *group, uint32_t value) {
+    uint8_t portValue = 0;
+    for (uint8_t j = 0; j < group->count; j++) {
+        portValue |= ((value >> group->bit[j]) & 1) << group->shift[j];
+    }
+    return portValue;
+}
+
+/*
+ * Output `value` on a compiled bus with one masked DATA store per port.
+ * Bits [9:2] of the DATA register offset select which pins a store
+ * modifies, so lines outside the bus on a shared port are untouched.
+ */
+static inline void writeBusMap(DriverLibBusMap *map, uint32_t value) {
+    map->value = value;
+    for (uint8_t i = 0; i < map->count; i++) {
+        const DriverLibPortGroup *group = &map->group[i];
+        HWREG(group->port + GPIO_O_DATA + (group->mask << 2)) = busPortValue(group, value);
+    }
+}
+
+/*
+ * Output `value` on a compiled bus, only storing to the lines that differ
+ * from the last value written. Ports with no changed lines are skipped.
+ */
+static inline void updateBusMap(DriverLibBusMap *map, uint32_t value) {
+    uint32_t changed = map->value ^ value;
+    map->value = value;
+
+    for (uint8_t i = 0; i < map->count && changed != 0; i++) {
+        const DriverLibPortGroup *group = &map->group[i];
+        uint32_t portValue = 0;
+        uint32_t portMask = 0;
+
+        if ((group->bits & changed) == 0) {
+            continue;
+        }
+
+        for (uint8_t j = 0; j < group->count; j++) {
+            if ((changed >> group->bit[j]) & 1) {
+                portValue |= ((value >> group->bit[j]) & 1) << group->shift[j];
+                portMask |= 1 << group->shift[j];
+            }
+        }
+        HWREG(group->port + GPIO_O_DATA + (portMask << 2)) = portValue;
+        changed &= ~group->bits;
+    }
+}
+
+/*
+ * Build the scatter and gather tables of a data pin group.
+ */
+static void compileDataTables(DriverLibBusMap *map, const DriverLibGpioPin *pins,
+        uint8_t (*scatter)[MAX_PORT_COUNT], uint8_t (*gather)[1 << MAX_DATA_WIDTH]) {
+    compileBusMap(map, pins, MAX_DATA_WIDTH);
+
+    for (uint8_t i = 0; i < map->count; i++) {
+        const DriverLibPortGroup *group = &map->group[i];
+
+        for (uint32_t value = 0; value < (1 << MAX_DATA_WIDTH); value++) {
+            uint8_t portValue = 0;
+            uint8_t data = 0;
+            for (uint8_t j = 0; j < group->count; j++) {
+                portValue |= ((value >> group->bit[j]) & 1) << group->shift[j];
+                data |= ((value >> group->shift[j]) & 1) << group->bit[j];
+            }
+            scatter[value][i] = portValue;
+            /* Masked reads only ever index entries made of the group's pins. */
+            gather[i][value] = data;
+        }
+    }
+}
+
+#ifdef OPEN_EEPROM_PARALLEL_KERNELS
+/*
+ * Width-specialized parallel bus kernels.
+ *
+ * The macros below expand the compile-time pin map into constant
+ * per-port masks and values. With the bus width a constant as well,
+ * the compiler folds every pin test away and each port update becomes
+ * a handful of shifts and a single masked store. Ports that hold no
+ * bus lines produce a zero mask and disappear entirely.
+ */
+#define KERNEL_PORT_INDEX(port) \
+    ((port) == TM4C_PORTA_BASE ? 0 : (port) == TM4C_PORTB_BASE ? 1 : \
+     (port) == TM4C_PORTC_BASE ? 2 : (port) == TM4C_PORTD_BASE ? 3 : \
+     (port) == TM4C_PORTE_BASE ? 4 : 5)
+
+#define KERNEL_ADDRESS_TERM(i, port, width, address) \
+    (((i) < (width) && TM4C_A##i##_PORT == (port)) ? \
+        ((((address) >> (i)) & 1) * TM4C_A##i##_PIN) : 0)
+
+#define KERNEL_ADDRESS_VALUE(port, width, address) ( \
+    KERNEL_ADDRESS_TERM(0, port, width, address) | \
+    KERNEL_ADDRESS_TERM(1, port, width, address) | \
+    KERNEL_ADDRESS_TERM(2, port, width, address) | \
+    KERNEL_ADDRESS_TERM(3, port, width, address) | \
+    KERNEL_ADDRESS_TERM(4, port, width, address) | \
+    KERNEL_ADDRESS_TERM(5, port, width, address) | \
+    KERNEL_ADDRESS_TERM(6, port, width, address) | \
+    KERNEL_ADDRESS_TERM(7, port, width, address) | \
+    KERNEL_ADDRESS_TERM(8, port, width, address) | \
+    KERNEL_ADDRESS_TERM(9, port, width, address) | \
+    KERNEL_ADDRESS_TERM(10, port, width, address) | \
+    KERNEL_ADDRESS_TERM(11, port, width, address) | \
+    KERNEL_ADDRESS_TERM(12, port, width, address) | \
+    KERNEL_ADDRESS_TERM(13, port, width, address) | \
+    KERNEL_ADDRESS_TERM(14, port, width, address))
+
+#define KERNEL_ADDRESS_MASK(port, width) \
+    KERNEL_ADDRESS_VALUE(port, width, 0xFFFFFFFFUL)
+
+#define KERNEL_ADDRESS_BIT(i, port, width) \
+    (((i) < (width) && TM4C_A##i##_PORT == (port)) ? (1UL << (i)) : 0)
+
+#define KERNEL_ADDRESS_BITS(port, width) ( \
+    KERNEL_ADDRESS_BIT(0, port, width) | \
+    KERNEL_ADDRESS_BIT(1, port, width) | \
+    KERNEL_ADDRESS_BIT(2, port, width) | \
+    KERNEL_ADDRESS_BIT(3, port, width) | \
+    KERNEL_ADDRESS_BIT(4, port, width) | \
+    KERNEL_ADDRESS_BIT(5, port, width) | \
+    KERNEL_ADDRESS_BIT(6, port, width) | \
+    KERNEL_ADDRESS_BIT(7, port, width) | \
+    KERNEL_ADDRESS_BIT(8, port, width) | \
+    KERNEL_ADDRESS_BIT(9, port, width) | \
+    KERNEL_ADDRESS_BIT(10, port, width) | \
+    KERNEL_ADDRESS_BIT(11, port, width) | \
+    KERNEL_ADDRESS_BIT(12, port, width) | \
+    KERNEL_ADDRESS_BIT(13, port, width) | \
+    KERNEL_ADDRESS_BIT(14, port, width))
+
+#define KERNEL_DATA_TERM(i, port, data) \
+    ((TM4C_IO##i##_PORT == (port)) ? ((((data) >> (i)) & 1) * TM4C_IO##i##_PIN) : 0)
+
+#define KERNEL_DATA_VALUE(port, data) ( \
+    KERNEL_DATA_TERM(0, port, data) | \
+    KERNEL_DATA_TERM(1, port, data) | \
+    KERNEL_DATA_TERM(2, port, data) | \
+    KERNEL_DATA_TERM(3, port, data) | \
+    KERNEL_DATA_TERM(4, port, data) | \
+    KERNEL_DATA_TERM(5, port, data) | \
+    KERNEL_DATA_TERM(6, port, data) | \
+    KERNEL_DATA_TERM(7, port, data))
+
+#define KERNEL_DATA_MASK(port) KERNEL_DATA_VALUE(port, 0xFF)
+
+#define KERNEL_DATA_IN_TERM(i, portValues) \
+    ((((portValues)[KERNEL_PORT_INDEX(TM4C_IO##i##_PORT)] & TM4C_IO##i##_PIN) != 0) << (i))
+
+#define KERNEL_DATA_IN(portValues) ( \
+    KERNEL_DATA_IN_TERM(0, portValues) | \
+    KERNEL_DATA_IN_TERM(1, portValues) | \
+    KERNEL_DATA_IN_TERM(2, portValues) | \
+    KERNEL_DATA_IN_TERM(3, portValues) | \
+    KERNEL_DATA_IN_TERM(4, portValues) | \
+    KERNEL_DATA_IN_TERM(5, portValues) | \
+    KERNEL_DATA_IN_TERM(6, portValues) | \
+    KERNEL_DATA_IN_TERM(7, portValues))
+
+#define KERNEL_PORT_REG(port, mask) \
+    HWREG((port) + GPIO_O_DATA + ((mask) << 2))
+
+/* Only store to ports whose address lines changed since `previous`. */
+#define KERNEL_UPDATE_ADDRESS_PORT(port, width, previous, address) \
+    if (KERNEL_ADDRESS_MASK(port, width) != 0 && \
+            (((previous) ^ (address)) & KERNEL_ADDRESS_BITS(port, width)) != 0) { \
+        KERNEL_PORT_REG(port, KERNEL_ADDRESS_MASK(port, width)) = \
+            KERNEL_ADDRESS_VALUE(port, width, address); \
+    }
+
+#define KERNEL_UPDATE_ADDRESS(width, previous, address) do { \
+    KERNEL_UPDATE_ADDRESS_PORT(TM4C_PORTA_BASE, width, previous, address) \
+    KERNEL_UPDATE_ADDRESS_PORT(TM4C_PORTB_BASE, width, previous, address) \
+    KERNEL_UPDATE_ADDRESS_PORT(TM4C_PORTC_BASE, width, previous, address) \
+    KERNEL_UPDATE_ADDRESS_PORT(TM4C_PORTD_BASE, width, previous, address) \
+    KERNEL_UPDATE_ADDRESS_PORT(TM4C_PORTE_BASE, width, previous, address) \
+    KERNEL_UPDATE_ADDRESS_PORT(TM4C_PORTF_BASE, width, previous, address) \
+} while (0)
+
+#define KERNEL_SET_DATA_PORT(port, data) \
+    if (KERNEL_DATA_MASK(port) != 0) { \
+        KERNEL_PORT_REG(port, KERNEL_DATA_MASK(port)) = KERNEL_DATA_VALUE(port, data); \
+    }
+
+#define KERNEL_SET_DATA(data) do { \
+    KERNEL_SET_DATA_PORT(TM4C_PORTA_BASE, data) \
+    KERNEL_SET_DATA_PORT(TM4C_PORTB_BASE, data) \
+    KERNEL_SET_DATA_PORT(TM4C_PORTC_BASE, data) \
+    KERNEL_SET_DATA_PORT(TM4C_PORTD_BASE, data) \
+    KERNEL_SET_DATA_PORT(TM4C_PORTE_BASE, data) \
+    KERNEL_SET_DATA_PORT(TM4C_PORTF_BASE, data) \
+} while (0)
+
+#define KERNEL_READ_DATA_PORT(port, portValues) \
+    if (KERNEL_DATA_MASK(port) != 0) { \
+        (portValues)[KERNEL_PORT_INDEX(port)] = KERNEL_PORT_REG(port, KERNEL_DATA_MASK(port)); \
+    }
+
+#define KERNEL_READ_DATA(portValues) do { \
+    KERNEL_READ_DATA_PORT(TM4C_PORTA_BASE, portValues) \
+    KERNEL_READ_DATA_PORT(TM4C_PORTB_BASE, portValues) \
+    KERNEL_READ_DATA_PORT(TM4C_PORTC_BASE, portValues) \
+    KERNEL_READ_DATA_PORT(TM4C_PORTD_BASE, portValues) \
+    KERNEL_READ_DATA_PORT(TM4C_PORTE_BASE, portValues) \
+    KERNEL_READ_DATA_PORT(TM4C_PORTF_BASE, portValues) \
+} while (0)
+
+static inline __attribute__((always_inline)) 
+void readKernel(const uint8_t width, uint32_t address, char *buf, size_t count, uint32_t holdTime) {
+    uint32_t previous = ~address;
+    uint32_t portValues[MAX_PORT_COUNT];
+
+    for (size_t i = 0; i < count; i++, address++) {
+        KERNEL_UPDATE_ADDRESS(width, previous, address);
+        previous = address;
+        delayCycles(holdTime);
+        KERNEL_READ_DATA(portValues);
+        buf[i] = KERNEL_DATA_IN(portValues);
+    }
+}
+
+static inline __attribute__((always_inline)) 
+void writeKernel(const uint8_t width, uint32_t address, const char *buf, size_t count, 
+        uint32_t holdTime, uint32_t pulseTime) {
+    uint32_t previous = ~address;
+
+    for (size_t i = 0; i < count; i++, address++) {
+        KERNEL_UPDATE_ADDRESS(width, previous, address);
+        previous = address;
+        KERNEL_SET_DATA((uint8_t) buf[i]);
+        delayCycles(holdTime);
+        Programmer_startCEPulse(pulseTime);
+        Programmer_waitCEPulse();
+    }
+}
+
+#define DEFINE_PARALLEL_KERNELS(width) \
+    static void readKernel##width(uint32_t address, char *buf, size_t count, \
+            uint32_t holdTime) { \
+        readKernel(width, address, buf, count, holdTime); \
+    } \
+    static void writeKernel##width(uint32_t address, const char *buf, size_t count, \
+            uint32_t holdTime, uint32_t pulseTime) { \
+        writeKernel(width, address, buf, count, holdTime, pulseTime); \
+    }
+
+/* Only widths whose lines are all driven straight from GPIO pins. */
+DEFINE_PARALLEL_KERNELS(8)
+#if TM4C_DIRECT_ADDRESS_WIDTH >= 11
+DEFINE_PARALLEL_KERNELS(11)
+#endif
+#if TM4C_DIRECT_ADDRESS_WIDTH >= 13
+DEFINE_PARALLEL_KERNELS(13)
+#endif
+#if TM4C_DIRECT_ADDRESS_WIDTH >= 15
+DEFINE_PARALLEL_KERNELS(15)
+#endif
+
+int Programmer_parallelReadKernel(uint8_t busWidth, uint32_t address, 
+        char *buf, size_t count, uint32_t holdTime) {
+    switch (busWidth) {
+        case 8: readKernel8(address, buf, count, holdTime); break;
+#if TM4C_DIRECT_ADDRESS_WIDTH >= 11
+        case 11: readKernel11(address, buf, count, holdTime); break;
+#endif
+#if TM4C_DIRECT_ADDRESS_WIDTH >= 13
+        case 13: readKernel13(address, buf, count, holdTime); break;
+#endif
+#if TM4C_DIRECT_ADDRESS_WIDTH >= 15
+        case 15: readKernel15(address, buf, count, holdTime); break;
+#endif
+        default: return 0;
+    }
+
+    /* The kernels bypass the address map, so keep its record in sync. */
+    if (count > 0 && busWidth == AddressBus.width) {
+        AddressBus.value = address + count - 1;
+    }
+    return 1;
+}
+
+int Programmer_parallelWriteKernel(uint8_t busWidth, uint32_t address, 
+        const char *buf, size_t count, uint32_t holdTime, uint32_t pulseTime) {
+    switch (busWidth) {
+        case 8: writeKernel8(address, buf, count, holdTime, pulseTime); break;
+#if TM4C_DIRECT_ADDRESS_WIDTH >= 11
+        case 11: writeKernel11(address, buf, count, holdTime, pulseTime); break;
+#endif
+#if TM4C_DIRECT_ADDRESS_WIDTH >= 13
+        case 13: writeKernel13(address, buf, count, holdTime, pulseTime); break;
+#endif
+#if TM4C_DIRECT_ADDRESS_WIDTH >= 15
+        case 15: writeKernel15(address, buf, count, holdTime, pulseTime); break;
+#endif
+        default: return 0;
+    }
+
+    if (count > 0 && busWidth == AddressBus.width) {
+        AddressBus.value = address + count - 1;
+    }
+    return 1;
+}
+#endif
+
+#ifdef OPEN_EEPROM_PARALLEL_CAPTURE
+/*
+ * Timer-paced uDMA read capture.
+ *
+ * Every data port and every address port gets its own timer half 
+ * and uDMA channel. All timers run in lockstep with the same period.
+ * On each timeout the data channels sample the byte for the current
+ * address, then the address channels store the port values for the
+ * next one. Timers are listed in channel order, and the data ports
+ * take the first entries, because uDMA serves simultaneous requests
+ * lowest channel first. The address is therefore always held for one
+ * full period before it is sampled.
+ *
+ * The capture runs in chunks. While the DMA samples one chunk, the CPU
+ * gathers the previous chunk into bytes and computes the address port
+ * values for the next one.
+ */
+static const DriverLibDmaTimer CaptureTimers[] = {
+    {SYSCTL_PERIPH_TIMER4, TIMER4_BASE, TIMER_A, TIMER_4A_SYNC, UDMA_CH0_TIMER4A},
+    {SYSCTL_PERIPH_TIMER4, TIMER4_BASE, TIMER_B, TIMER_4B_SYNC, UDMA_CH1_TIMER4B},
+    {SYSCTL_PERIPH_TIMER3, TIMER3_BASE, TIMER_A, TIMER_3A_SYNC, UDMA_CH2_TIMER3A},
+    {SYSCTL_PERIPH_TIMER3, TIMER3_BASE, TIMER_B, TIMER_3B_SYNC, UDMA_CH3_TIMER3B},
+    {SYSCTL_PERIPH_TIMER2, TIMER2_BASE, TIMER_A, TIMER_2A_SYNC, UDMA_CH4_TIMER2A},
+    {SYSCTL_PERIPH_TIMER2, TIMER2_BASE, TIMER_B, TIMER_2B_SYNC, UDMA_CH5_TIMER2B},
+    {SYSCTL_PERIPH_TIMER5, TIMER5_BASE, TIMER_A, TIMER_5A_SYNC, UDMA_CH8_TIMER5A},
+    {SYSCTL_PERIPH_TIMER5, TIMER5_BASE, TIMER_B, TIMER_5B_SYNC, UDMA_CH9_TIMER5B},
+    {SYSCTL_PERIPH_TIMER1, TIMER1_BASE, TIMER_A, TIMER_1A_SYNC, UDMA_CH20_TIMER1A},
+    {SYSCTL_PERIPH_TIMER1, TIMER1_BASE, TIMER_B, TIMER_1B_SYNC, UDMA_CH21_TIMER1B},
+};
+
+#define CAPTURE_TIMER_COUNT (sizeof(CaptureTimers) / sizeof(CaptureTimers[0]))
+#define CAPTURE_CHANNEL(t) ((t)->mapping & 0xFF)
+
+static uint8_t DmaControlTable[1024] __attribute__((aligned(1024)));
+static uint8_t CaptureData[2][MAX_PORT_COUNT][TM4C_CAPTURE_CHUNK];
+static uint8_t CaptureAddress[2][MAX_PORT_COUNT][TM4C_CAPTURE_CHUNK];
+static bool CaptureReady;
+
+static void initCapture(void) {
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_UDMA);
+    /* Timer 0 holds the register that synchronizes all the timers. */
+    SysCtlPeripheralEnable(SYSCTL_PERIPH_TIMER0);
+    for (size_t i = 0; i < CAPTURE_TIMER_COUNT; i++) {
+        SysCtlPeripheralEnable(CaptureTimers[i].periph);
+        while (!SysCtlPeripheralReady(CaptureTimers[i].periph))
+            ;
+        TimerConfigure(CaptureTimers[i].base, 
+                TIMER_CFG_SPLIT_PAIR | TIMER_CFG_A_PERIODIC | TIMER_CFG_B_PERIODIC);
+    }
+    while (!SysCtlPeripheralReady(SYSCTL_PERIPH_UDMA))
+        ;
+    uDMAEnable();
+    uDMAControlBaseSet(DmaControlTable);
+    CaptureReady = true;
+}
+
+static void prepareCaptureAddresses(uint8_t buf, uint32_t address, size_t count) {
+    for (uint8_t g = 0; g < AddressBus.count; g++) {
+        for (size_t k = 0; k < count; k++) {
+            CaptureAddress[buf][g][k] = busPortValue(&AddressBus.group[g], address + k);
+        }
+    }
+}
+
+static void gatherCapture(uint8_t buf, char *out, size_t count) {
+    for (size_t k = 0; k < count; k++) {
+        uint8_t data = 0;
+        for (uint8_t g = 0; g < DataBus.count; g++) {
+            data |= DataGather[g][CaptureData[buf][g][k]];
+        }
+        out[k] = data;
+    }
+}
+
+static void startCapture(uint8_t buf, size_t count, uint32_t period) {
+    uint32_t sync = 0;
+    size_t t = 0;
+
+    for (uint8_t g = 0; g < DataBus.count; g++, t++) {
+        const DriverLibDmaTimer *timer = &CaptureTimers[t];
+        const DriverLibPortGroup *group = &DataBus.group[g];
+        uDMAChannelAssign(timer->mapping);
+        uDMAChannelAttributeDisable(CAPTURE_CHANNEL(timer), UDMA_ATTR_ALL);
+        uDMAChannelControlSet(CAPTURE_CHANNEL(timer) | UDMA_PRI_SELECT, 
+                UDMA_SIZE_8 | UDMA_SRC_INC_NONE | UDMA_DST_INC_8 | UDMA_ARB_1);
+        uDMAChannelTransferSet(CAPTURE_CHANNEL(timer) | UDMA_PRI_SELECT, UDMA_MODE_BASIC, 
+                (void *) (group->port + GPIO_O_DATA + (group->mask << 2)), 
+                CaptureData[buf][g], count);
+    }
+
+    for (uint8_t g = 0; g < AddressBus.count; g++, t++) {
+        const DriverLibDmaTimer *timer = &CaptureTimers[t];
+        const DriverLibPortGroup *group = &AddressBus.group[g];
+        uDMAChannelAssign(timer->mapping);
+        uDMAChannelAttributeDisable(CAPTURE_CHANNEL(timer), UDMA_ATTR_ALL);
+        uDMAChannelControlSet(CAPTURE_CHANNEL(timer) | UDMA_PRI_SELECT, 
+                UDMA_SIZE_8 | UDMA_SRC_INC_8 | UDMA_DST_INC_NONE | UDMA_ARB_1);
+        uDMAChannelTransferSet(CAPTURE_CHANNEL(timer) | UDMA_PRI_SELECT, UDMA_MODE_BASIC, 
+                CaptureAddress[buf][g], 
+                (void *) (group->port + GPIO_O_DATA + (group->mask << 2)), count);
+    }
+
+    for (size_t i = 0; i < t; i++) {
+        const DriverLibDmaTimer *timer = &CaptureTimers[i];
+        TimerLoadSet(timer->base, timer->timer, period - 1);
+        TimerIntClear(timer->base, timer->timer == TIMER_A ? TIMER_TIMA_TIMEOUT : TIMER_TIMB_TIMEOUT);
+        uDMAChannelEnable(CAPTURE_CHANNEL(timer));
+        TimerEnable(timer->base, timer->timer);
+        sync |= timer->sync;
+    }
+
+    /* Restart every timer at once so they time out together. */
+    TimerSynchronize(TIMER0_BASE, sync);
+}
+
+static void finishCapture(void) {
+    size_t used = DataBus.count + AddressBus.count;
+
+    for (size_t i = 0; i < used; i++) {
+        while (uDMAChannelIsEnabled(CAPTURE_CHANNEL(&CaptureTimers[i])))
+            ;
+    }
+    for (size_t i = 0; i < used; i++) {
+        TimerDisable(CaptureTimers[i].base, CaptureTimers[i].timer);
+    }
+}
+
+int Programmer_parallelReadCapture(uint8_t busWidth, uint32_t address, 
+        char *buf, size_t count, uint32_t holdTime) {
+    uint32_t period = holdTime + TM4C_CAPTURE_SERVICE_CYCLES;
+    size_t done = 0, previous = 0, previousCount = 0;
+    uint8_t current = 0;
+
+    /* Only addresses driven straight from the GPIO pins can be captured. */
+    if (busWidth > TM4C_DIRECT_ADDRESS_WIDTH) {
+        return 0;
+    }
+    if (busWidth != AddressBus.width) {
+        compileBusMap(&AddressBus, ProgrPtr->A, busWidth);
+    }
+
+    /* Timer halves only count 16 bits without a prescaler. */
+    if (count == 0 || period > 0xFFFF || 
+            DataBus.count + AddressBus.count > CAPTURE_TIMER_COUNT) {
+        return 0;
+    }
+
+    if (!CaptureReady) {
+        initCapture();
+    }
+
+    /* The first address is set by the CPU, each step the DMA 
+       stores the address of the byte it samples next. */
+    writeBusMap(&AddressBus, address);
+    delayCycles(holdTime);
+    prepareCaptureAddresses(current, address + 1, 
+            count < TM4C_CAPTURE_CHUNK ? count : TM4C_CAPTURE_CHUNK);
+
+    while (done < count) {
+        size_t chunk = count - done < TM4C_CAPTURE_CHUNK ? count - done : TM4C_CAPTURE_CHUNK;
+        size_t remaining = count - done - chunk;
+
+        startCapture(current, chunk, period);
+
+        if (previousCount > 0) {
+            gatherCapture(current ^ 1, &buf[previous], previousCount);
+        }
+        if (remaining > 0) {
+            prepareCaptureAddresses(current ^ 1, address + done + chunk + 1, 
+                    remaining < TM4C_CAPTURE_CHUNK ? remaining : TM4C_CAPTURE_CHUNK);
+        }
+
+        finishCapture();
+
+        previous = done;
+        previousCount = chunk;
+        done += chunk;
+        current ^= 1;
+    }
+    gatherCapture(current ^ 1, &buf[previous], previousCount);
+
+    AddressBus.value = address + count;
+    return 1;
+}
+#endif
+
 int Transport_init(void) {
     SysCtlPeripheralEnable(SYSCTL_PERIPH_UART0);
     SysCtlPeripheralEnable(SYSCTL_PERIPH_GPIOA);
 
     GPIOPinConfigure(GPIO_PA0_U0RX);
     GPIOPinConfigure(GPIO_PA1_U0TX);
-    GPIOPinTypeUART(GPIO_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
+    GPIOPinTypeUART(TM4C_PORTA_BASE, GPIO_PIN_0 | GPIO_PIN_1);
 
     UARTConfigSetExpClk(UART0_BASE, SysCtlClockGet(), 115200, 
             (UART_CONFIG_WLEN_8 | UART_CONFIG_STOP_ONE | UART_CONFIG_PAR_NONE));